@@ -1,7 +1,258 @@
+/*
+ * Runtime dispatch of BLAKE2b implementation variants.
+ */
+
+#include <string.h>
+
 #include "pyblake2_impl_common.h"
+#include "pyblake2_dispatch.h"
+#include "impl/blake2.h"
+
+typedef struct {
+    const char *name;
+    unsigned int features; /* required PYBLAKE2_CPU_* flags */
+    int (*init_param)(blake2b_state *S, const blake2b_param *P);
+    int (*init)(blake2b_state *S, const uint8_t outlen);
+    int (*init_key)(blake2b_state *S, const uint8_t outlen,
+                    const void *key, const uint8_t keylen);
+    int (*update)(blake2b_state *S, const uint8_t *in, uint64_t inlen);
+    int (*flush)(blake2b_state *S);
+    int (*final)(blake2b_state *S, uint8_t *out, uint8_t outlen);
+    int (*hash)(uint8_t *out, const void *in, const void *key,
+                const uint8_t outlen, const uint64_t inlen, uint8_t keylen);
+} blake2b_impl;
+
+#define DECL_BLAKE2B_VARIANT(variant, required)                               \
+    int blake2b_init_param_##variant(blake2b_state *S,                        \
+                                     const blake2b_param *P);                 \
+    int blake2b_init_##variant(blake2b_state *S, const uint8_t outlen);       \
+    int blake2b_init_key_##variant(blake2b_state *S, const uint8_t outlen,    \
+                                   const void *key, const uint8_t keylen);    \
+    int blake2b_update_##variant(blake2b_state *S, const uint8_t *in,         \
+                                 uint64_t inlen);                             \
+    int blake2b_flush_##variant(blake2b_state *S);                            \
+    int blake2b_final_##variant(blake2b_state *S, uint8_t *out,               \
+                                uint8_t outlen);                              \
+    int blake2b_##variant(uint8_t *out, const void *in, const void *key,      \
+                          const uint8_t outlen, const uint64_t inlen,         \
+                          uint8_t keylen);                                    \
+                                                                              \
+    static const blake2b_impl blake2b_impl_##variant = {                      \
+        #variant, required,                                                   \
+        blake2b_init_param_##variant, blake2b_init_##variant,                 \
+        blake2b_init_key_##variant, blake2b_update_##variant,                 \
+        blake2b_flush_##variant, blake2b_final_##variant,                     \
+        blake2b_##variant                                                     \
+    };
+
+DECL_BLAKE2B_VARIANT(ref, 0)
+#ifdef PYBLAKE2_X86
+DECL_BLAKE2B_VARIANT(sse2, PYBLAKE2_CPU_SSE2)
+DECL_BLAKE2B_VARIANT(ssse3, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3)
+DECL_BLAKE2B_VARIANT(sse41, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                            PYBLAKE2_CPU_SSE41)
+# ifdef PYBLAKE2_HAVE_AVX_VARIANT
+DECL_BLAKE2B_VARIANT(avx, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                          PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX)
+# endif
+# ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+DECL_BLAKE2B_VARIANT(avx512, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                             PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX |
+                             PYBLAKE2_CPU_AVX2 | PYBLAKE2_CPU_AVX512)
+# endif
+# ifdef PYBLAKE2_HAVE_XOP_VARIANT
+DECL_BLAKE2B_VARIANT(xop, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                          PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX |
+                          PYBLAKE2_CPU_XOP)
+# endif
+#endif
+
+/* Multi-buffer kernels compress nblocks blocks into each of N states. */
+typedef void (*blake2b_compress_multi)(blake2b_state **S,
+                                       const uint8_t *const *in,
+                                       size_t nblocks, size_t stride);
+
+#ifdef PYBLAKE2_HAVE_AVX2_VARIANT
+void blake2b_compress_x4(blake2b_state *S[4], const uint8_t *const in[4],
+                         size_t nblocks, size_t stride);
+#endif
+#ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+void blake2b_compress_x8(blake2b_state *S[8], const uint8_t *const in[8],
+                         size_t nblocks, size_t stride);
+#endif
+
+/* Variants in order of preference. */
+static const blake2b_impl *const blake2b_impls[] = {
+#ifdef PYBLAKE2_X86
+# ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+    &blake2b_impl_avx512,
+# endif
+# ifdef PYBLAKE2_HAVE_XOP_VARIANT
+    &blake2b_impl_xop,
+# endif
+# ifdef PYBLAKE2_HAVE_AVX_VARIANT
+    &blake2b_impl_avx,
+# endif
+    &blake2b_impl_sse41,
+    &blake2b_impl_ssse3,
+#endif
+    &blake2b_impl_ref,
+#ifdef PYBLAKE2_X86
+    /* pure SSE2 implementation is slower than the portable one, so it's
+     * only used when forced: https://github.com/dchest/pyblake2/issues/11 */
+    &blake2b_impl_sse2,
+#endif
+    NULL
+};
+
+static const blake2b_impl *blake2b_selected = &blake2b_impl_ref;
+
+/* Multi-buffer kernels for four and eight states; NULL if not supported. */
+static blake2b_compress_multi blake2b_selected_x4 = NULL;
+static blake2b_compress_multi blake2b_selected_x8 = NULL;
+
+const char *
+blake2b_select_impl(unsigned int features)
+{
+    const blake2b_impl *const *p;
+
+    /* Forced variant falls back to ref if not supported by this CPU. */
+    blake2b_selected = &blake2b_impl_ref;
+    for (p = blake2b_impls; *p != NULL; p++) {
+        if (((*p)->features & features) != (*p)->features)
+            continue;
+#ifdef BLAKE2_FORCED_VARIANT
+        if (strcmp((*p)->name, BLAKE2_FORCED_VARIANT) != 0)
+            continue;
+#endif
+        blake2b_selected = *p;
+        break;
+    }
 
-#ifdef USE_OPTIMIZED_IMPL
-#include "impl/blake2b.c"
-#else
-#include "impl/blake2b-ref.c"
+    blake2b_selected_x4 = NULL;
+    blake2b_selected_x8 = NULL;
+#ifndef BLAKE2_FORCED_VARIANT
+# ifdef PYBLAKE2_HAVE_AVX2_VARIANT
+    if (features & PYBLAKE2_CPU_AVX2)
+        blake2b_selected_x4 = blake2b_compress_x4;
+# endif
+# ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+    if (features & PYBLAKE2_CPU_AVX512)
+        blake2b_selected_x8 = blake2b_compress_x8;
+# endif
 #endif
+
+    return blake2b_selected->name;
+}
+
+/*
+ * Public API.
+ */
+
+int
+blake2b_init_param(blake2b_state *S, const blake2b_param *P)
+{
+    return blake2b_selected->init_param(S, P);
+}
+
+int
+blake2b_init(blake2b_state *S, const uint8_t outlen)
+{
+    return blake2b_selected->init(S, outlen);
+}
+
+int
+blake2b_init_key(blake2b_state *S, const uint8_t outlen,
+                 const void *key, const uint8_t keylen)
+{
+    return blake2b_selected->init_key(S, outlen, key, keylen);
+}
+
+int
+blake2b_update(blake2b_state *S, const uint8_t *in, uint64_t inlen)
+{
+    return blake2b_selected->update(S, in, inlen);
+}
+
+int
+blake2b_flush(blake2b_state *S)
+{
+    return blake2b_selected->flush(S);
+}
+
+int
+blake2b_final(blake2b_state *S, uint8_t *out, uint8_t outlen)
+{
+    return blake2b_selected->final(S, out, outlen);
+}
+
+int
+blake2b(uint8_t *out, const void *in, const void *key,
+        const uint8_t outlen, const uint64_t inlen, uint8_t keylen)
+{
+    return blake2b_selected->hash(out, in, key, outlen, inlen, keylen);
+}
+
+/*
+ * Multi-buffer API.
+ */
+
+static int
+blake2b_update_multi(blake2b_compress_multi compress, size_t n,
+                     blake2b_state **S, const uint8_t *const *in,
+                     size_t nblocks, size_t stride)
+{
+    const uint8_t *bufs[8];
+    size_t pending = S[0]->buflen;
+    size_t i, k;
+
+    for (i = 1; i < n; i++) {
+        if (S[i]->buflen != pending)
+            break;
+    }
+
+    if (compress == NULL || nblocks == 0 || i < n ||
+            pending % BLAKE2B_BLOCKBYTES != 0) {
+        for (i = 0; i < n; i++) {
+            for (k = 0; k < nblocks; k++)
+                blake2b_update(S[i], in[i] + k * stride, BLAKE2B_BLOCKBYTES);
+        }
+        return 0;
+    }
+
+    /* Only the last of the new blocks may turn out to be the final one,
+     * so buffered blocks and the rest of new ones are compressed now. */
+    if (pending > 0) {
+        for (i = 0; i < n; i++)
+            bufs[i] = S[i]->buf;
+        compress(S, bufs, pending / BLAKE2B_BLOCKBYTES, BLAKE2B_BLOCKBYTES);
+    }
+    if (nblocks > 1)
+        compress(S, in, nblocks - 1, stride);
+
+    for (i = 0; i < n; i++) {
+        memcpy(S[i]->buf, in[i] + (nblocks - 1) * stride, BLAKE2B_BLOCKBYTES);
+        S[i]->buflen = BLAKE2B_BLOCKBYTES;
+    }
+    return 0;
+}
+
+int
+blake2b_update_x4(blake2b_state *S[4], const uint8_t *const in[4],
+                  size_t nblocks, size_t stride)
+{
+    return blake2b_update_multi(blake2b_selected_x4, 4,
+                                S, in, nblocks, stride);
+}
+
+int
+blake2b_update_x8(blake2b_state *S[8], const uint8_t *const in[8],
+                  size_t nblocks, size_t stride)
+{
+    if (blake2b_selected_x8 == NULL) {
+        blake2b_update_x4(S, in, nblocks, stride);
+        return blake2b_update_x4(S + 4, in + 4, nblocks, stride);
+    }
+    return blake2b_update_multi(blake2b_selected_x8, 8,
+                                S, in, nblocks, stride);
+}
@@ -0,0 +1,7 @@
+#define BLAKE2_IMPL_VARIANT avx
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_HAVE_AVX_VARIANT
+# define HAVE_AVX
+# include "impl/blake2b.c"
+#endif
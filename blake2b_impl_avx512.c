@@ -0,0 +1,7 @@
+#define BLAKE2_IMPL_VARIANT avx512
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+# define HAVE_AVX512
+# include "impl/blake2b.c"
+#endif
@@ -0,0 +1,7 @@
+#define BLAKE2_IMPL_VARIANT sse2
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_X86
+# define HAVE_SSE2
+# include "impl/blake2b.c"
+#endif
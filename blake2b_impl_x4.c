@@ -0,0 +1,5 @@
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_HAVE_AVX2_VARIANT
+# include "impl/blake2b-x4.c"
+#endif
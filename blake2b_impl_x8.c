@@ -0,0 +1,5 @@
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+# include "impl/blake2b-x8.c"
+#endif
@@ -0,0 +1,3 @@
+#include "pyblake2_impl_common.h"
+
+#include "impl/blake2bp.c"
@@ -1,7 +1,219 @@
+/*
+ * Runtime dispatch of BLAKE2s implementation variants.
+ */
+
+#include <string.h>
+
 #include "pyblake2_impl_common.h"
+#include "pyblake2_dispatch.h"
+#include "impl/blake2.h"
+
+typedef struct {
+    const char *name;
+    unsigned int features; /* required PYBLAKE2_CPU_* flags */
+    int (*init_param)(blake2s_state *S, const blake2s_param *P);
+    int (*init)(blake2s_state *S, const uint8_t outlen);
+    int (*init_key)(blake2s_state *S, const uint8_t outlen,
+                    const void *key, const uint8_t keylen);
+    int (*update)(blake2s_state *S, const uint8_t *in, uint64_t inlen);
+    int (*flush)(blake2s_state *S);
+    int (*final)(blake2s_state *S, uint8_t *out, uint8_t outlen);
+    int (*hash)(uint8_t *out, const void *in, const void *key,
+                const uint8_t outlen, const uint64_t inlen, uint8_t keylen);
+} blake2s_impl;
+
+#define DECL_BLAKE2S_VARIANT(variant, required)                               \
+    int blake2s_init_param_##variant(blake2s_state *S,                        \
+                                     const blake2s_param *P);                 \
+    int blake2s_init_##variant(blake2s_state *S, const uint8_t outlen);       \
+    int blake2s_init_key_##variant(blake2s_state *S, const uint8_t outlen,    \
+                                   const void *key, const uint8_t keylen);    \
+    int blake2s_update_##variant(blake2s_state *S, const uint8_t *in,         \
+                                 uint64_t inlen);                             \
+    int blake2s_flush_##variant(blake2s_state *S);                            \
+    int blake2s_final_##variant(blake2s_state *S, uint8_t *out,               \
+                                uint8_t outlen);                              \
+    int blake2s_##variant(uint8_t *out, const void *in, const void *key,      \
+                          const uint8_t outlen, const uint64_t inlen,         \
+                          uint8_t keylen);                                    \
+                                                                              \
+    static const blake2s_impl blake2s_impl_##variant = {                      \
+        #variant, required,                                                   \
+        blake2s_init_param_##variant, blake2s_init_##variant,                 \
+        blake2s_init_key_##variant, blake2s_update_##variant,                 \
+        blake2s_flush_##variant, blake2s_final_##variant,                     \
+        blake2s_##variant                                                     \
+    };
+
+DECL_BLAKE2S_VARIANT(ref, 0)
+#ifdef PYBLAKE2_X86
+DECL_BLAKE2S_VARIANT(sse2, PYBLAKE2_CPU_SSE2)
+DECL_BLAKE2S_VARIANT(ssse3, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3)
+DECL_BLAKE2S_VARIANT(sse41, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                            PYBLAKE2_CPU_SSE41)
+# ifdef PYBLAKE2_HAVE_AVX_VARIANT
+DECL_BLAKE2S_VARIANT(avx, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                          PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX)
+# endif
+# ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+DECL_BLAKE2S_VARIANT(avx512, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                             PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX |
+                             PYBLAKE2_CPU_AVX2 | PYBLAKE2_CPU_AVX512)
+# endif
+# ifdef PYBLAKE2_HAVE_XOP_VARIANT
+DECL_BLAKE2S_VARIANT(xop, PYBLAKE2_CPU_SSE2 | PYBLAKE2_CPU_SSSE3 |
+                          PYBLAKE2_CPU_SSE41 | PYBLAKE2_CPU_AVX |
+                          PYBLAKE2_CPU_XOP)
+# endif
+#endif
+
+#ifdef PYBLAKE2_HAVE_AVX2_VARIANT
+void blake2s_compress_x8(blake2s_state *S[8], const uint8_t *const in[8],
+                         size_t nblocks, size_t stride);
+#endif
+
+/* Variants in order of preference. */
+static const blake2s_impl *const blake2s_impls[] = {
+#ifdef PYBLAKE2_X86
+# ifdef PYBLAKE2_HAVE_AVX512_VARIANT
+    &blake2s_impl_avx512,
+# endif
+# ifdef PYBLAKE2_HAVE_XOP_VARIANT
+    &blake2s_impl_xop,
+# endif
+# ifdef PYBLAKE2_HAVE_AVX_VARIANT
+    &blake2s_impl_avx,
+# endif
+    &blake2s_impl_sse41,
+    &blake2s_impl_ssse3,
+#endif
+    &blake2s_impl_ref,
+#ifdef PYBLAKE2_X86
+    /* pure SSE2 implementation is slower than the portable one, so it's
+     * only used when forced: https://github.com/dchest/pyblake2/issues/11 */
+    &blake2s_impl_sse2,
+#endif
+    NULL
+};
+
+static const blake2s_impl *blake2s_selected = &blake2s_impl_ref;
+
+/* Compresses blocks into eight states at once; NULL if not supported. */
+static void (*blake2s_selected_x8)(blake2s_state *S[8],
+                                   const uint8_t *const in[8],
+                                   size_t nblocks, size_t stride) = NULL;
+
+const char *
+blake2s_select_impl(unsigned int features)
+{
+    const blake2s_impl *const *p;
+
+    /* Forced variant falls back to ref if not supported by this CPU. */
+    blake2s_selected = &blake2s_impl_ref;
+    for (p = blake2s_impls; *p != NULL; p++) {
+        if (((*p)->features & features) != (*p)->features)
+            continue;
+#ifdef BLAKE2_FORCED_VARIANT
+        if (strcmp((*p)->name, BLAKE2_FORCED_VARIANT) != 0)
+            continue;
+#endif
+        blake2s_selected = *p;
+        break;
+    }
 
-#ifdef USE_OPTIMIZED_IMPL
-#include "impl/blake2s.c"
-#else
-#include "impl/blake2s-ref.c"
+    blake2s_selected_x8 = NULL;
+#if defined(PYBLAKE2_HAVE_AVX2_VARIANT) && !defined(BLAKE2_FORCED_VARIANT)
+    if (features & PYBLAKE2_CPU_AVX2)
+        blake2s_selected_x8 = blake2s_compress_x8;
 #endif
+
+    return blake2s_selected->name;
+}
+
+/*
+ * Public API.
+ */
+
+int
+blake2s_init_param(blake2s_state *S, const blake2s_param *P)
+{
+    return blake2s_selected->init_param(S, P);
+}
+
+int
+blake2s_init(blake2s_state *S, const uint8_t outlen)
+{
+    return blake2s_selected->init(S, outlen);
+}
+
+int
+blake2s_init_key(blake2s_state *S, const uint8_t outlen,
+                 const void *key, const uint8_t keylen)
+{
+    return blake2s_selected->init_key(S, outlen, key, keylen);
+}
+
+int
+blake2s_update(blake2s_state *S, const uint8_t *in, uint64_t inlen)
+{
+    return blake2s_selected->update(S, in, inlen);
+}
+
+int
+blake2s_flush(blake2s_state *S)
+{
+    return blake2s_selected->flush(S);
+}
+
+int
+blake2s_final(blake2s_state *S, uint8_t *out, uint8_t outlen)
+{
+    return blake2s_selected->final(S, out, outlen);
+}
+
+int
+blake2s(uint8_t *out, const void *in, const void *key,
+        const uint8_t outlen, const uint64_t inlen, uint8_t keylen)
+{
+    return blake2s_selected->hash(out, in, key, outlen, inlen, keylen);
+}
+
+int
+blake2s_update_x8(blake2s_state *S[8], const uint8_t *const in[8],
+                  size_t nblocks, size_t stride)
+{
+    const uint8_t *bufs[8];
+    size_t pending = S[0]->buflen;
+    size_t i, k;
+
+    for (i = 1; i < 8; i++) {
+        if (S[i]->buflen != pending)
+            break;
+    }
+
+    if (blake2s_selected_x8 == NULL || nblocks == 0 || i < 8 ||
+            pending % BLAKE2S_BLOCKBYTES != 0) {
+        for (i = 0; i < 8; i++) {
+            for (k = 0; k < nblocks; k++)
+                blake2s_update(S[i], in[i] + k * stride, BLAKE2S_BLOCKBYTES);
+        }
+        return 0;
+    }
+
+    /* Only the last of the new blocks may turn out to be the final one,
+     * so buffered blocks and the rest of new ones are compressed now. */
+    if (pending > 0) {
+        for (i = 0; i < 8; i++)
+            bufs[i] = S[i]->buf;
+        blake2s_selected_x8(S, bufs, pending / BLAKE2S_BLOCKBYTES,
+                            BLAKE2S_BLOCKBYTES);
+    }
+    if (nblocks > 1)
+        blake2s_selected_x8(S, in, nblocks - 1, stride);
+
+    for (i = 0; i < 8; i++) {
+        memcpy(S[i]->buf, in[i] + (nblocks - 1) * stride, BLAKE2S_BLOCKBYTES);
+        S[i]->buflen = BLAKE2S_BLOCKBYTES;
+    }
+    return 0;
+}
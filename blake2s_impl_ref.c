@@ -0,0 +1,4 @@
+#define BLAKE2_IMPL_VARIANT ref
+#include "pyblake2_impl_common.h"
+
+#include "impl/blake2s-ref.c"
@@ -0,0 +1,7 @@
+#define BLAKE2_IMPL_VARIANT ssse3
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_X86
+# define HAVE_SSSE3
+# include "impl/blake2s.c"
+#endif
@@ -0,0 +1,7 @@
+#define BLAKE2_IMPL_VARIANT xop
+#include "pyblake2_impl_common.h"
+
+#ifdef PYBLAKE2_HAVE_XOP_VARIANT
+# define HAVE_XOP
+# include "impl/blake2s.c"
+#endif
@@ -16,6 +16,12 @@
 #ifndef __BLAKE2_CONFIG_H__
 #define __BLAKE2_CONFIG_H__
 
+#ifdef HAVE_AVX512
+#ifndef HAVE_AVX2
+#define HAVE_AVX2
+#endif
+#endif
+
 #ifdef HAVE_AVX2
 #ifndef HAVE_AVX
 #define HAVE_AVX
@@ -55,7 +55,7 @@ extern "C" {
     uint32_t h[8];
     uint32_t t[2];
     uint32_t f[2];
-    uint8_t  buf[2 * BLAKE2S_BLOCKBYTES];
+    uint8_t  buf[BLAKE2S_BLOCKBYTES];
     size_t   buflen;
     uint8_t  last_node;
   } blake2s_state;
@@ -65,7 +65,7 @@ extern "C" {
     uint64_t h[8];
     uint64_t t[2];
     uint64_t f[2];
-    uint8_t  buf[2 * BLAKE2B_BLOCKBYTES];
+    uint8_t  buf[BLAKE2B_BLOCKBYTES];
     size_t   buflen;
     uint8_t  last_node;
   } blake2b_state;
@@ -124,24 +124,35 @@ extern "C" {
   int blake2s_init_key( blake2s_state *S, const uint8_t outlen, const void *key, const uint8_t keylen );
   int blake2s_init_param( blake2s_state *S, const blake2s_param *P );
   int blake2s_update( blake2s_state *S, const uint8_t *in, uint64_t inlen );
+  int blake2s_flush( blake2s_state *S );
   int blake2s_final( blake2s_state *S, uint8_t *out, uint8_t outlen );
 
   int blake2b_init( blake2b_state *S, const uint8_t outlen );
   int blake2b_init_key( blake2b_state *S, const uint8_t outlen, const void *key, const uint8_t keylen );
   int blake2b_init_param( blake2b_state *S, const blake2b_param *P );
   int blake2b_update( blake2b_state *S, const uint8_t *in, uint64_t inlen );
+  int blake2b_flush( blake2b_state *S );
   int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen );
 
   int blake2sp_init( blake2sp_state *S, const uint8_t outlen );
   int blake2sp_init_key( blake2sp_state *S, const uint8_t outlen, const void *key, const uint8_t keylen );
+  int blake2sp_init_param( blake2sp_state *S, const blake2s_param *P, const void *key );
   int blake2sp_update( blake2sp_state *S, const uint8_t *in, uint64_t inlen );
   int blake2sp_final( blake2sp_state *S, uint8_t *out, uint8_t outlen );
 
   int blake2bp_init( blake2bp_state *S, const uint8_t outlen );
   int blake2bp_init_key( blake2bp_state *S, const uint8_t outlen, const void *key, const uint8_t keylen );
+  int blake2bp_init_param( blake2bp_state *S, const blake2b_param *P, const void *key );
   int blake2bp_update( blake2bp_state *S, const uint8_t *in, uint64_t inlen );
   int blake2bp_final( blake2bp_state *S, uint8_t *out, uint8_t outlen );
 
+  /* Multi-buffer API: same as calling blake2b_update( S[i], in[i] + k * stride,
+     BLAKE2B_BLOCKBYTES ) for each state i and block k < nblocks (likewise
+     for BLAKE2s). */
+  int blake2b_update_x4( blake2b_state *S[4], const uint8_t *const in[4], size_t nblocks, size_t stride );
+  int blake2b_update_x8( blake2b_state *S[8], const uint8_t *const in[8], size_t nblocks, size_t stride );
+  int blake2s_update_x8( blake2s_state *S[8], const uint8_t *const in[8], size_t nblocks, size_t stride );
+
   /* Simple API */
   int blake2s( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen );
   int blake2b( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen );
@@ -26,7 +26,10 @@
 
 
 /* Microarchitecture-specific macros */
-#ifndef HAVE_XOP
+#if defined(HAVE_AVX512)
+/* AVX-512VL has native rotates for 128-bit vectors */
+#define _mm_roti_epi64(x, c) _mm_ror_epi64((x), -(c))
+#elif !defined(HAVE_XOP)
 #ifdef HAVE_SSSE3
 #define _mm_roti_epi64(x, c) \
     (-(c) == 32) ? _mm_shuffle_epi32((x), _MM_SHUFFLE(2,3,0,1))  \
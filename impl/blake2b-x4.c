@@ -0,0 +1,180 @@
+/*
+   BLAKE2b multi-buffer compression for AVX2.
+
+   Compresses four independent BLAKE2b states at once: each 256-bit
+   register holds the same state word of four messages, one message per
+   64-bit lane, so every instruction works on four compression functions.
+*/
+
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+
+#include <immintrin.h>
+
+static const uint64_t blake2b_IV[8] =
+{
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+  0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+  0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint8_t blake2b_sigma[12][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 } ,
+  { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 } ,
+  {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 } ,
+  {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 } ,
+  {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 } ,
+  { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 } ,
+  { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 } ,
+  {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 } ,
+  { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0 } ,
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
+};
+
+#define LOADU256(p)    _mm256_loadu_si256( (const __m256i *)(p) )
+#define STOREU256(p,r) _mm256_storeu_si256( (__m256i *)(p), r )
+
+#define ADD(a, b) _mm256_add_epi64( a, b )
+#define XOR(a, b) _mm256_xor_si256( a, b )
+
+#define ROT32(x) _mm256_shuffle_epi32( (x), _MM_SHUFFLE(2,3,0,1) )
+#define ROT24(x) _mm256_shuffle_epi8( (x), r24 )
+#define ROT16(x) _mm256_shuffle_epi8( (x), r16 )
+#define ROT63(x) _mm256_or_si256( _mm256_srli_epi64( (x), 63 ), ADD( (x), (x) ) )
+
+#define G(r,i,a,b,c,d) \
+  do { \
+    a = ADD( ADD( a, b ), m[blake2b_sigma[r][2*i+0]] ); \
+    d = ROT32( XOR( d, a ) ); \
+    c = ADD( c, d ); \
+    b = ROT24( XOR( b, c ) ); \
+    a = ADD( ADD( a, b ), m[blake2b_sigma[r][2*i+1]] ); \
+    d = ROT16( XOR( d, a ) ); \
+    c = ADD( c, d ); \
+    b = ROT63( XOR( b, c ) ); \
+  } while(0)
+
+#define ROUND(r) \
+  do { \
+    G(r,0,v[ 0],v[ 4],v[ 8],v[12]); \
+    G(r,1,v[ 1],v[ 5],v[ 9],v[13]); \
+    G(r,2,v[ 2],v[ 6],v[10],v[14]); \
+    G(r,3,v[ 3],v[ 7],v[11],v[15]); \
+    G(r,4,v[ 0],v[ 5],v[10],v[15]); \
+    G(r,5,v[ 1],v[ 6],v[11],v[12]); \
+    G(r,6,v[ 2],v[ 7],v[ 8],v[13]); \
+    G(r,7,v[ 3],v[ 4],v[ 9],v[14]); \
+  } while(0)
+
+/* Transposes four rows of four 64-bit words. */
+#define TRANSPOSE4(a, b, c, d) \
+  do { \
+    __m256i t0 = _mm256_unpacklo_epi64( a, b ); \
+    __m256i t1 = _mm256_unpackhi_epi64( a, b ); \
+    __m256i t2 = _mm256_unpacklo_epi64( c, d ); \
+    __m256i t3 = _mm256_unpackhi_epi64( c, d ); \
+    a = _mm256_permute2x128_si256( t0, t2, 0x20 ); \
+    b = _mm256_permute2x128_si256( t1, t3, 0x20 ); \
+    c = _mm256_permute2x128_si256( t0, t2, 0x31 ); \
+    d = _mm256_permute2x128_si256( t1, t3, 0x31 ); \
+  } while(0)
+
+/* Loads word j of four states into lanes 0..3. */
+#define LOAD_LANES(S, field, j) \
+  _mm256_set_epi64x( (int64_t)S[3]->field[j], (int64_t)S[2]->field[j], \
+                     (int64_t)S[1]->field[j], (int64_t)S[0]->field[j] )
+
+/* Compresses nblocks blocks into each of four states: block k of state i
+   is read from in[i] + k * stride. Counters are advanced by a full block
+   before every compression, so no block may be the last one. */
+void blake2b_compress_x4( blake2b_state *S[4], const uint8_t *const in[4], size_t nblocks, size_t stride )
+{
+  const __m256i r16 = _mm256_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                        2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
+  const __m256i r24 = _mm256_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                        3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
+  const __m256i blockbytes = _mm256_set1_epi64x( BLAKE2B_BLOCKBYTES );
+  const __m256i sign = _mm256_set1_epi64x( (int64_t)0x8000000000000000ULL );
+  __m256i h[8], v[16], m[16];
+  __m256i t0, t1, f0, f1;
+  uint64_t lanes[4];
+  size_t i, j, k;
+
+  for( j = 0; j < 8; ++j )
+    h[j] = LOAD_LANES( S, h, j );
+
+  t0 = LOAD_LANES( S, t, 0 );
+  t1 = LOAD_LANES( S, t, 1 );
+  f0 = LOAD_LANES( S, f, 0 );
+  f1 = LOAD_LANES( S, f, 1 );
+
+  for( k = 0; k < nblocks; ++k )
+  {
+    const size_t offset = k * stride;
+
+    /* Load 16 words of each message and transpose them, so that m[j]
+       holds word j of all four messages. */
+    for( j = 0; j < 16; j += 4 )
+    {
+      m[j + 0] = LOADU256( in[0] + offset + j * 8 );
+      m[j + 1] = LOADU256( in[1] + offset + j * 8 );
+      m[j + 2] = LOADU256( in[2] + offset + j * 8 );
+      m[j + 3] = LOADU256( in[3] + offset + j * 8 );
+      TRANSPOSE4( m[j + 0], m[j + 1], m[j + 2], m[j + 3] );
+    }
+
+    /* 128-bit counter increment; carry is detected with an unsigned
+       comparison emulated by flipping the sign bits. */
+    t0 = ADD( t0, blockbytes );
+    t1 = _mm256_sub_epi64( t1, _mm256_cmpgt_epi64( XOR( blockbytes, sign ), XOR( t0, sign ) ) );
+
+    for( j = 0; j < 8; ++j )
+      v[j] = h[j];
+
+    v[ 8] = _mm256_set1_epi64x( (int64_t)blake2b_IV[0] );
+    v[ 9] = _mm256_set1_epi64x( (int64_t)blake2b_IV[1] );
+    v[10] = _mm256_set1_epi64x( (int64_t)blake2b_IV[2] );
+    v[11] = _mm256_set1_epi64x( (int64_t)blake2b_IV[3] );
+    v[12] = XOR( t0, _mm256_set1_epi64x( (int64_t)blake2b_IV[4] ) );
+    v[13] = XOR( t1, _mm256_set1_epi64x( (int64_t)blake2b_IV[5] ) );
+    v[14] = XOR( f0, _mm256_set1_epi64x( (int64_t)blake2b_IV[6] ) );
+    v[15] = XOR( f1, _mm256_set1_epi64x( (int64_t)blake2b_IV[7] ) );
+
+    ROUND( 0 );
+    ROUND( 1 );
+    ROUND( 2 );
+    ROUND( 3 );
+    ROUND( 4 );
+    ROUND( 5 );
+    ROUND( 6 );
+    ROUND( 7 );
+    ROUND( 8 );
+    ROUND( 9 );
+    ROUND( 10 );
+    ROUND( 11 );
+
+    for( j = 0; j < 8; ++j )
+      h[j] = XOR( h[j], XOR( v[j], v[j + 8] ) );
+  }
+
+  for( j = 0; j < 8; ++j )
+  {
+    STOREU256( lanes, h[j] );
+    for( i = 0; i < 4; ++i )
+      S[i]->h[j] = lanes[i];
+  }
+
+  STOREU256( lanes, t0 );
+  for( i = 0; i < 4; ++i )
+    S[i]->t[0] = lanes[i];
+
+  STOREU256( lanes, t1 );
+  for( i = 0; i < 4; ++i )
+    S[i]->t[1] = lanes[i];
+}
@@ -0,0 +1,191 @@
+/*
+   BLAKE2b multi-buffer compression for AVX-512.
+
+   Compresses eight independent BLAKE2b states at once: each 512-bit
+   register holds the same state word of eight messages, one message per
+   64-bit lane, so every instruction works on eight compression functions.
+*/
+
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+
+#include <immintrin.h>
+
+static const uint64_t blake2b_IV[8] =
+{
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+  0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+  0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint8_t blake2b_sigma[12][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 } ,
+  { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 } ,
+  {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 } ,
+  {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 } ,
+  {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 } ,
+  { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 } ,
+  { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 } ,
+  {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 } ,
+  { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0 } ,
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
+};
+
+#define LOADU512(p)    _mm512_loadu_si512( (const void *)(p) )
+#define STOREU512(p,r) _mm512_storeu_si512( (void *)(p), r )
+
+#define ADD(a, b) _mm512_add_epi64( a, b )
+#define XOR(a, b) _mm512_xor_si512( a, b )
+#define ROR(x, c) _mm512_ror_epi64( (x), c )
+
+#define G(r,i,a,b,c,d) \
+  do { \
+    a = ADD( ADD( a, b ), m[blake2b_sigma[r][2*i+0]] ); \
+    d = ROR( XOR( d, a ), 32 ); \
+    c = ADD( c, d ); \
+    b = ROR( XOR( b, c ), 24 ); \
+    a = ADD( ADD( a, b ), m[blake2b_sigma[r][2*i+1]] ); \
+    d = ROR( XOR( d, a ), 16 ); \
+    c = ADD( c, d ); \
+    b = ROR( XOR( b, c ), 63 ); \
+  } while(0)
+
+#define ROUND(r) \
+  do { \
+    G(r,0,v[ 0],v[ 4],v[ 8],v[12]); \
+    G(r,1,v[ 1],v[ 5],v[ 9],v[13]); \
+    G(r,2,v[ 2],v[ 6],v[10],v[14]); \
+    G(r,3,v[ 3],v[ 7],v[11],v[15]); \
+    G(r,4,v[ 0],v[ 5],v[10],v[15]); \
+    G(r,5,v[ 1],v[ 6],v[11],v[12]); \
+    G(r,6,v[ 2],v[ 7],v[ 8],v[13]); \
+    G(r,7,v[ 3],v[ 4],v[ 9],v[14]); \
+  } while(0)
+
+/* Transposes eight rows of eight 64-bit words in place. */
+#define TRANSPOSE8(x) \
+  do { \
+    __m512i t0 = _mm512_unpacklo_epi64( x[0], x[1] ); \
+    __m512i t1 = _mm512_unpackhi_epi64( x[0], x[1] ); \
+    __m512i t2 = _mm512_unpacklo_epi64( x[2], x[3] ); \
+    __m512i t3 = _mm512_unpackhi_epi64( x[2], x[3] ); \
+    __m512i t4 = _mm512_unpacklo_epi64( x[4], x[5] ); \
+    __m512i t5 = _mm512_unpackhi_epi64( x[4], x[5] ); \
+    __m512i t6 = _mm512_unpacklo_epi64( x[6], x[7] ); \
+    __m512i t7 = _mm512_unpackhi_epi64( x[6], x[7] ); \
+    __m512i u0 = _mm512_shuffle_i64x2( t0, t2, _MM_SHUFFLE(2,0,2,0) ); \
+    __m512i u1 = _mm512_shuffle_i64x2( t0, t2, _MM_SHUFFLE(3,1,3,1) ); \
+    __m512i u2 = _mm512_shuffle_i64x2( t1, t3, _MM_SHUFFLE(2,0,2,0) ); \
+    __m512i u3 = _mm512_shuffle_i64x2( t1, t3, _MM_SHUFFLE(3,1,3,1) ); \
+    __m512i u4 = _mm512_shuffle_i64x2( t4, t6, _MM_SHUFFLE(2,0,2,0) ); \
+    __m512i u5 = _mm512_shuffle_i64x2( t4, t6, _MM_SHUFFLE(3,1,3,1) ); \
+    __m512i u6 = _mm512_shuffle_i64x2( t5, t7, _MM_SHUFFLE(2,0,2,0) ); \
+    __m512i u7 = _mm512_shuffle_i64x2( t5, t7, _MM_SHUFFLE(3,1,3,1) ); \
+    x[0] = _mm512_shuffle_i64x2( u0, u4, _MM_SHUFFLE(2,0,2,0) ); \
+    x[1] = _mm512_shuffle_i64x2( u2, u6, _MM_SHUFFLE(2,0,2,0) ); \
+    x[2] = _mm512_shuffle_i64x2( u1, u5, _MM_SHUFFLE(2,0,2,0) ); \
+    x[3] = _mm512_shuffle_i64x2( u3, u7, _MM_SHUFFLE(2,0,2,0) ); \
+    x[4] = _mm512_shuffle_i64x2( u0, u4, _MM_SHUFFLE(3,1,3,1) ); \
+    x[5] = _mm512_shuffle_i64x2( u2, u6, _MM_SHUFFLE(3,1,3,1) ); \
+    x[6] = _mm512_shuffle_i64x2( u1, u5, _MM_SHUFFLE(3,1,3,1) ); \
+    x[7] = _mm512_shuffle_i64x2( u3, u7, _MM_SHUFFLE(3,1,3,1) ); \
+  } while(0)
+
+/* Loads word j of eight states into lanes 0..7. */
+#define LOAD_LANES(S, field, j) \
+  _mm512_set_epi64( (int64_t)S[7]->field[j], (int64_t)S[6]->field[j], \
+                    (int64_t)S[5]->field[j], (int64_t)S[4]->field[j], \
+                    (int64_t)S[3]->field[j], (int64_t)S[2]->field[j], \
+                    (int64_t)S[1]->field[j], (int64_t)S[0]->field[j] )
+
+/* Compresses nblocks blocks into each of eight states: block k of state i
+   is read from in[i] + k * stride. Counters are advanced by a full block
+   before every compression, so no block may be the last one. */
+void blake2b_compress_x8( blake2b_state *S[8], const uint8_t *const in[8], size_t nblocks, size_t stride )
+{
+  const __m512i blockbytes = _mm512_set1_epi64( BLAKE2B_BLOCKBYTES );
+  const __m512i one = _mm512_set1_epi64( 1 );
+  __m512i h[8], v[16], m[16];
+  __m512i t0, t1, f0, f1;
+  __mmask8 carry;
+  uint64_t lanes[8];
+  size_t i, j, k;
+
+  for( j = 0; j < 8; ++j )
+    h[j] = LOAD_LANES( S, h, j );
+
+  t0 = LOAD_LANES( S, t, 0 );
+  t1 = LOAD_LANES( S, t, 1 );
+  f0 = LOAD_LANES( S, f, 0 );
+  f1 = LOAD_LANES( S, f, 1 );
+
+  for( k = 0; k < nblocks; ++k )
+  {
+    const size_t offset = k * stride;
+
+    /* Load 16 words of each message and transpose them, so that m[j]
+       holds word j of all eight messages. */
+    for( i = 0; i < 8; ++i )
+    {
+      m[i]     = LOADU512( in[i] + offset );
+      m[i + 8] = LOADU512( in[i] + offset + 64 );
+    }
+
+    TRANSPOSE8( m );
+    TRANSPOSE8( ( m + 8 ) );
+
+    /* 128-bit counter increment */
+    t0 = ADD( t0, blockbytes );
+    carry = _mm512_cmplt_epu64_mask( t0, blockbytes );
+    t1 = _mm512_mask_add_epi64( t1, carry, t1, one );
+
+    for( j = 0; j < 8; ++j )
+      v[j] = h[j];
+
+    v[ 8] = _mm512_set1_epi64( (int64_t)blake2b_IV[0] );
+    v[ 9] = _mm512_set1_epi64( (int64_t)blake2b_IV[1] );
+    v[10] = _mm512_set1_epi64( (int64_t)blake2b_IV[2] );
+    v[11] = _mm512_set1_epi64( (int64_t)blake2b_IV[3] );
+    v[12] = XOR( t0, _mm512_set1_epi64( (int64_t)blake2b_IV[4] ) );
+    v[13] = XOR( t1, _mm512_set1_epi64( (int64_t)blake2b_IV[5] ) );
+    v[14] = XOR( f0, _mm512_set1_epi64( (int64_t)blake2b_IV[6] ) );
+    v[15] = XOR( f1, _mm512_set1_epi64( (int64_t)blake2b_IV[7] ) );
+
+    ROUND( 0 );
+    ROUND( 1 );
+    ROUND( 2 );
+    ROUND( 3 );
+    ROUND( 4 );
+    ROUND( 5 );
+    ROUND( 6 );
+    ROUND( 7 );
+    ROUND( 8 );
+    ROUND( 9 );
+    ROUND( 10 );
+    ROUND( 11 );
+
+    for( j = 0; j < 8; ++j )
+      h[j] = XOR( h[j], XOR( v[j], v[j + 8] ) );
+  }
+
+  for( j = 0; j < 8; ++j )
+  {
+    STOREU512( lanes, h[j] );
+    for( i = 0; i < 8; ++i )
+      S[i]->h[j] = lanes[i];
+  }
+
+  STOREU512( lanes, t0 );
+  for( i = 0; i < 8; ++i )
+    S[i]->t[0] = lanes[i];
+
+  STOREU512( lanes, t1 );
+  for( i = 0; i < 8; ++i )
+    S[i]->t[1] = lanes[i];
+}
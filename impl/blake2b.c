@@ -263,7 +263,7 @@ BLAKE2_LOCAL_INLINE(int) blake2b_compress( blake2b_state *S, const uint8_t block
   __m128i row4l, row4h;
   __m128i b0, b1;
   __m128i t0, t1;
-#if defined(HAVE_SSSE3) && !defined(HAVE_XOP)
+#if defined(HAVE_SSSE3) && !defined(HAVE_XOP) && !defined(HAVE_AVX512)
   const __m128i r16 = _mm_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
   const __m128i r24 = _mm_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
 #endif
@@ -328,35 +328,49 @@ BLAKE2_LOCAL_INLINE(int) blake2b_compress( blake2b_state *S, const uint8_t block
 
 int blake2b_update( blake2b_state *S, const uint8_t *in, uint64_t inlen )
 {
-  while( inlen > 0 )
+  size_t left = S->buflen;
+  size_t fill = BLAKE2B_BLOCKBYTES - left;
+
+  /* The last block is kept buffered, as it may turn out to be the final
+     one; all others are compressed directly from the input. */
+  if( inlen > fill )
   {
-    size_t left = S->buflen;
-    size_t fill = 2 * BLAKE2B_BLOCKBYTES - left;
+    memcpy( S->buf + left, in, fill ); /* Fill buffer */
+    blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
+    blake2b_compress( S, S->buf ); /* Compress */
+    in += fill;
+    inlen -= fill;
+    left = 0;
 
-    if( inlen > fill )
+    while( inlen > BLAKE2B_BLOCKBYTES )
     {
-      memcpy( S->buf + left, in, fill ); /* Fill buffer */
-      S->buflen += fill;
       blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
-      blake2b_compress( S, S->buf ); /* Compress */
-      memcpy( S->buf, S->buf + BLAKE2B_BLOCKBYTES, BLAKE2B_BLOCKBYTES ); /* Shift buffer left */
-      S->buflen -= BLAKE2B_BLOCKBYTES;
-      in += fill;
-      inlen -= fill;
-    }
-    else /* inlen <= fill */
-    {
-      memcpy( S->buf + left, in, inlen );
-      S->buflen += inlen; /* Be lazy, do not compress */
-      in += inlen;
-      inlen -= inlen;
+      blake2b_compress( S, in );
+      in += BLAKE2B_BLOCKBYTES;
+      inlen -= BLAKE2B_BLOCKBYTES;
     }
   }
 
+  memcpy( S->buf + left, in, inlen );
+  S->buflen = left + inlen; /* Be lazy, do not compress */
   return 0;
 }
 
 
+/* Compress the buffered block if it is full; the state is left with an
+   empty buffer. Fails if the buffer is not full or the state is final. */
+int blake2b_flush( blake2b_state *S )
+{
+  if( S->buflen != BLAKE2B_BLOCKBYTES || blake2b_is_lastblock( S ) )
+    return -1;
+
+  blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
+  blake2b_compress( S, S->buf );
+  secure_zero_memory( S->buf, BLAKE2B_BLOCKBYTES );
+  S->buflen = 0;
+  return 0;
+}
+
 int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen )
 {
   if( outlen > BLAKE2B_OUTBYTES )
@@ -365,17 +379,9 @@ int blake2b_final( blake2b_state *S, uint8_t *out, uint8_t outlen )
   if( blake2b_is_lastblock( S ) )
     return -1;
 
-  if( S->buflen > BLAKE2B_BLOCKBYTES )
-  {
-    blake2b_increment_counter( S, BLAKE2B_BLOCKBYTES );
-    blake2b_compress( S, S->buf );
-    S->buflen -= BLAKE2B_BLOCKBYTES;
-    memmove( S->buf, S->buf + BLAKE2B_BLOCKBYTES, S->buflen );
-  }
-
   blake2b_increment_counter( S, S->buflen );
   blake2b_set_lastblock( S );
-  memset( S->buf + S->buflen, 0, 2 * BLAKE2B_BLOCKBYTES - S->buflen ); /* Padding */
+  memset( S->buf + S->buflen, 0, BLAKE2B_BLOCKBYTES - S->buflen ); /* Padding */
   blake2b_compress( S, S->buf );
   memcpy( out, &S->h[0], outlen );
   return 0;
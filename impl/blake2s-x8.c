@@ -0,0 +1,192 @@
+/*
+   BLAKE2s multi-buffer compression for AVX2.
+
+   Compresses eight independent BLAKE2s states at once: each 256-bit
+   register holds the same state word of eight messages, one message per
+   32-bit lane, so every instruction works on eight compression functions.
+*/
+
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+
+#include <immintrin.h>
+
+static const uint32_t blake2s_IV[8] =
+{
+  0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+  0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL
+};
+
+static const uint8_t blake2s_sigma[10][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 } ,
+  { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 } ,
+  {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 } ,
+  {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 } ,
+  {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 } ,
+  { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 } ,
+  { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 } ,
+  {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 } ,
+  { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0 } ,
+};
+
+#define LOADU256(p)    _mm256_loadu_si256( (const __m256i *)(p) )
+#define STOREU256(p,r) _mm256_storeu_si256( (__m256i *)(p), r )
+
+#define ADD(a, b) _mm256_add_epi32( a, b )
+#define XOR(a, b) _mm256_xor_si256( a, b )
+
+#define ROT16(x) _mm256_shuffle_epi8( (x), r16 )
+#define ROT12(x) _mm256_or_si256( _mm256_srli_epi32( (x), 12 ), _mm256_slli_epi32( (x), 20 ) )
+#define ROT8(x)  _mm256_shuffle_epi8( (x), r8 )
+#define ROT7(x)  _mm256_or_si256( _mm256_srli_epi32( (x), 7 ), _mm256_slli_epi32( (x), 25 ) )
+
+#define G(r,i,a,b,c,d) \
+  do { \
+    a = ADD( ADD( a, b ), m[blake2s_sigma[r][2*i+0]] ); \
+    d = ROT16( XOR( d, a ) ); \
+    c = ADD( c, d ); \
+    b = ROT12( XOR( b, c ) ); \
+    a = ADD( ADD( a, b ), m[blake2s_sigma[r][2*i+1]] ); \
+    d = ROT8( XOR( d, a ) ); \
+    c = ADD( c, d ); \
+    b = ROT7( XOR( b, c ) ); \
+  } while(0)
+
+#define ROUND(r) \
+  do { \
+    G(r,0,v[ 0],v[ 4],v[ 8],v[12]); \
+    G(r,1,v[ 1],v[ 5],v[ 9],v[13]); \
+    G(r,2,v[ 2],v[ 6],v[10],v[14]); \
+    G(r,3,v[ 3],v[ 7],v[11],v[15]); \
+    G(r,4,v[ 0],v[ 5],v[10],v[15]); \
+    G(r,5,v[ 1],v[ 6],v[11],v[12]); \
+    G(r,6,v[ 2],v[ 7],v[ 8],v[13]); \
+    G(r,7,v[ 3],v[ 4],v[ 9],v[14]); \
+  } while(0)
+
+/* Transposes eight rows of eight 32-bit words in place. */
+#define TRANSPOSE8(x) \
+  do { \
+    __m256i t0 = _mm256_unpacklo_epi32( x[0], x[1] ); \
+    __m256i t1 = _mm256_unpackhi_epi32( x[0], x[1] ); \
+    __m256i t2 = _mm256_unpacklo_epi32( x[2], x[3] ); \
+    __m256i t3 = _mm256_unpackhi_epi32( x[2], x[3] ); \
+    __m256i t4 = _mm256_unpacklo_epi32( x[4], x[5] ); \
+    __m256i t5 = _mm256_unpackhi_epi32( x[4], x[5] ); \
+    __m256i t6 = _mm256_unpacklo_epi32( x[6], x[7] ); \
+    __m256i t7 = _mm256_unpackhi_epi32( x[6], x[7] ); \
+    __m256i u0 = _mm256_unpacklo_epi64( t0, t2 ); \
+    __m256i u1 = _mm256_unpackhi_epi64( t0, t2 ); \
+    __m256i u2 = _mm256_unpacklo_epi64( t1, t3 ); \
+    __m256i u3 = _mm256_unpackhi_epi64( t1, t3 ); \
+    __m256i u4 = _mm256_unpacklo_epi64( t4, t6 ); \
+    __m256i u5 = _mm256_unpackhi_epi64( t4, t6 ); \
+    __m256i u6 = _mm256_unpacklo_epi64( t5, t7 ); \
+    __m256i u7 = _mm256_unpackhi_epi64( t5, t7 ); \
+    x[0] = _mm256_permute2x128_si256( u0, u4, 0x20 ); \
+    x[1] = _mm256_permute2x128_si256( u1, u5, 0x20 ); \
+    x[2] = _mm256_permute2x128_si256( u2, u6, 0x20 ); \
+    x[3] = _mm256_permute2x128_si256( u3, u7, 0x20 ); \
+    x[4] = _mm256_permute2x128_si256( u0, u4, 0x31 ); \
+    x[5] = _mm256_permute2x128_si256( u1, u5, 0x31 ); \
+    x[6] = _mm256_permute2x128_si256( u2, u6, 0x31 ); \
+    x[7] = _mm256_permute2x128_si256( u3, u7, 0x31 ); \
+  } while(0)
+
+/* Loads word j of eight states into lanes 0..7. */
+#define LOAD_LANES(S, field, j) \
+  _mm256_set_epi32( (int)S[7]->field[j], (int)S[6]->field[j], \
+                    (int)S[5]->field[j], (int)S[4]->field[j], \
+                    (int)S[3]->field[j], (int)S[2]->field[j], \
+                    (int)S[1]->field[j], (int)S[0]->field[j] )
+
+/* Compresses nblocks blocks into each of eight states: block k of state i
+   is read from in[i] + k * stride. Counters are advanced by a full block
+   before every compression, so no block may be the last one. */
+void blake2s_compress_x8( blake2s_state *S[8], const uint8_t *const in[8], size_t nblocks, size_t stride )
+{
+  const __m256i r16 = _mm256_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 );
+  const __m256i r8 = _mm256_setr_epi8( 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                                       1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 );
+  const __m256i blockbytes = _mm256_set1_epi32( BLAKE2S_BLOCKBYTES );
+  const __m256i sign = _mm256_set1_epi32( (int)0x80000000UL );
+  __m256i h[8], v[16], m[16];
+  __m256i t0, t1, f0, f1;
+  uint32_t lanes[8];
+  size_t i, j, k;
+
+  for( j = 0; j < 8; ++j )
+    h[j] = LOAD_LANES( S, h, j );
+
+  t0 = LOAD_LANES( S, t, 0 );
+  t1 = LOAD_LANES( S, t, 1 );
+  f0 = LOAD_LANES( S, f, 0 );
+  f1 = LOAD_LANES( S, f, 1 );
+
+  for( k = 0; k < nblocks; ++k )
+  {
+    const size_t offset = k * stride;
+
+    /* Load 16 words of each message and transpose them, so that m[j]
+       holds word j of all eight messages. */
+    for( i = 0; i < 8; ++i )
+    {
+      m[i]     = LOADU256( in[i] + offset );
+      m[i + 8] = LOADU256( in[i] + offset + 32 );
+    }
+
+    TRANSPOSE8( m );
+    TRANSPOSE8( ( m + 8 ) );
+
+    /* 64-bit counter increment; carry is detected with an unsigned
+       comparison emulated by flipping the sign bits. */
+    t0 = ADD( t0, blockbytes );
+    t1 = _mm256_sub_epi32( t1, _mm256_cmpgt_epi32( XOR( blockbytes, sign ), XOR( t0, sign ) ) );
+
+    for( j = 0; j < 8; ++j )
+      v[j] = h[j];
+
+    v[ 8] = _mm256_set1_epi32( (int)blake2s_IV[0] );
+    v[ 9] = _mm256_set1_epi32( (int)blake2s_IV[1] );
+    v[10] = _mm256_set1_epi32( (int)blake2s_IV[2] );
+    v[11] = _mm256_set1_epi32( (int)blake2s_IV[3] );
+    v[12] = XOR( t0, _mm256_set1_epi32( (int)blake2s_IV[4] ) );
+    v[13] = XOR( t1, _mm256_set1_epi32( (int)blake2s_IV[5] ) );
+    v[14] = XOR( f0, _mm256_set1_epi32( (int)blake2s_IV[6] ) );
+    v[15] = XOR( f1, _mm256_set1_epi32( (int)blake2s_IV[7] ) );
+
+    ROUND( 0 );
+    ROUND( 1 );
+    ROUND( 2 );
+    ROUND( 3 );
+    ROUND( 4 );
+    ROUND( 5 );
+    ROUND( 6 );
+    ROUND( 7 );
+    ROUND( 8 );
+    ROUND( 9 );
+
+    for( j = 0; j < 8; ++j )
+      h[j] = XOR( h[j], XOR( v[j], v[j + 8] ) );
+  }
+
+  for( j = 0; j < 8; ++j )
+  {
+    STOREU256( lanes, h[j] );
+    for( i = 0; i < 8; ++i )
+      S[i]->h[j] = lanes[i];
+  }
+
+  STOREU256( lanes, t0 );
+  for( i = 0; i < 8; ++i )
+    S[i]->t[0] = lanes[i];
+
+  STOREU256( lanes, t1 );
+  for( i = 0; i < 8; ++i )
+    S[i]->t[1] = lanes[i];
+}
@@ -253,7 +253,7 @@ BLAKE2_LOCAL_INLINE(int) blake2s_compress( blake2s_state *S, const uint8_t block
 #endif
 #endif
   __m128i ff0, ff1;
-#if defined(HAVE_SSSE3) && !defined(HAVE_XOP)
+#if defined(HAVE_SSSE3) && !defined(HAVE_XOP) && !defined(HAVE_AVX512)
   const __m128i r8 = _mm_set_epi8( 12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1 );
   const __m128i r16 = _mm_set_epi8( 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2 );
 #endif
@@ -302,31 +302,45 @@ BLAKE2_LOCAL_INLINE(int) blake2s_compress( blake2s_state *S, const uint8_t block
 /* inlen now in bytes */
 int blake2s_update( blake2s_state *S, const uint8_t *in, uint64_t inlen )
 {
-  while( inlen > 0 )
+  size_t left = S->buflen;
+  size_t fill = BLAKE2S_BLOCKBYTES - left;
+
+  /* The last block is kept buffered, as it may turn out to be the final
+     one; all others are compressed directly from the input. */
+  if( inlen > fill )
   {
-    size_t left = S->buflen;
-    size_t fill = 2 * BLAKE2S_BLOCKBYTES - left;
+    memcpy( S->buf + left, in, fill ); /* Fill buffer */
+    blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
+    blake2s_compress( S, S->buf ); /* Compress */
+    in += fill;
+    inlen -= fill;
+    left = 0;
 
-    if( inlen > fill )
+    while( inlen > BLAKE2S_BLOCKBYTES )
     {
-      memcpy( S->buf + left, in, fill ); /* Fill buffer */
-      S->buflen += fill;
       blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
-      blake2s_compress( S, S->buf ); /* Compress */
-      memcpy( S->buf, S->buf + BLAKE2S_BLOCKBYTES, BLAKE2S_BLOCKBYTES ); /* Shift buffer left */
-      S->buflen -= BLAKE2S_BLOCKBYTES;
-      in += fill;
-      inlen -= fill;
-    }
-    else /* inlen <= fill */
-    {
-      memcpy( S->buf + left, in, inlen );
-      S->buflen += inlen; /* Be lazy, do not compress */
-      in += inlen;
-      inlen -= inlen;
+      blake2s_compress( S, in );
+      in += BLAKE2S_BLOCKBYTES;
+      inlen -= BLAKE2S_BLOCKBYTES;
     }
   }
 
+  memcpy( S->buf + left, in, inlen );
+  S->buflen = left + inlen; /* Be lazy, do not compress */
+  return 0;
+}
+
+/* Compress the buffered block if it is full; the state is left with an
+   empty buffer. Fails if the buffer is not full or the state is final. */
+int blake2s_flush( blake2s_state *S )
+{
+  if( S->buflen != BLAKE2S_BLOCKBYTES || blake2s_is_lastblock( S ) )
+    return -1;
+
+  blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
+  blake2s_compress( S, S->buf );
+  secure_zero_memory( S->buf, BLAKE2S_BLOCKBYTES );
+  S->buflen = 0;
   return 0;
 }
 
@@ -342,17 +356,9 @@ int blake2s_final( blake2s_state *S, uint8_t *out, uint8_t outlen )
   if( blake2s_is_lastblock( S ) )
     return -1;
 
-  if( S->buflen > BLAKE2S_BLOCKBYTES )
-  {
-    blake2s_increment_counter( S, BLAKE2S_BLOCKBYTES );
-    blake2s_compress( S, S->buf );
-    S->buflen -= BLAKE2S_BLOCKBYTES;
-    memmove( S->buf, S->buf + BLAKE2S_BLOCKBYTES, S->buflen );
-  }
-
   blake2s_increment_counter( S, ( uint32_t )S->buflen );
   blake2s_set_lastblock( S );
-  memset( S->buf + S->buflen, 0, 2 * BLAKE2S_BLOCKBYTES - S->buflen ); /* Padding */
+  memset( S->buf + S->buflen, 0, BLAKE2S_BLOCKBYTES - S->buflen ); /* Padding */
   blake2s_compress( S, S->buf );
 
   for( i = 0; i < 8; ++i ) /* Output full hash to temp buffer */
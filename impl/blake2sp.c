@@ -0,0 +1,224 @@
+/*
+   BLAKE2 reference source code package - optimized C implementations
+
+   Copyright 2012, Samuel Neves <sneves@dei.uc.pt>.  You may use this under the
+   terms of the CC0, the OpenSSL Licence, or the Apache Public License 2.0, at
+   your option.  The terms of these licenses can be found at:
+
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+   - OpenSSL license   : https://www.openssl.org/source/license.html
+   - Apache 2.0        : http://www.apache.org/licenses/LICENSE-2.0
+
+   More information about the BLAKE2 hash function can be found at
+   https://blake2.net.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+
+#define PARALLELISM_DEGREE 8
+
+BLAKE2_LOCAL_INLINE(int) blake2sp_init_leaf( blake2s_state *S, const blake2s_param *T, uint64_t offset )
+{
+  blake2s_param P[1];
+  *P = *T;
+  P->fanout = PARALLELISM_DEGREE;
+  P->depth = 2;
+  store32( &P->leaf_length, 0 );
+  store48( &P->node_offset, offset );
+  P->node_depth = 0;
+  P->inner_length = BLAKE2S_OUTBYTES;
+  return blake2s_init_param( S, P );
+}
+
+BLAKE2_LOCAL_INLINE(int) blake2sp_init_root( blake2s_state *S, const blake2s_param *T )
+{
+  blake2s_param P[1];
+  *P = *T;
+  P->fanout = PARALLELISM_DEGREE;
+  P->depth = 2;
+  store32( &P->leaf_length, 0 );
+  store48( &P->node_offset, 0 );
+  P->node_depth = 1;
+  P->inner_length = BLAKE2S_OUTBYTES;
+  return blake2s_init_param( S, P );
+}
+
+
+/* Only digest_length, key_length, salt and personal are taken from P;
+   the tree parameters are fixed by BLAKE2sp. key may be NULL if
+   P->key_length is zero. */
+int blake2sp_init_param( blake2sp_state *S, const blake2s_param *P, const void *key )
+{
+  size_t i;
+
+  if( !P->digest_length || P->digest_length > BLAKE2S_OUTBYTES ) return -1;
+
+  if( P->key_length > BLAKE2S_KEYBYTES ) return -1;
+
+  if( P->key_length && !key ) return -1;
+
+  memset( S->buf, 0, sizeof( S->buf ) );
+  S->buflen = 0;
+
+  if( blake2sp_init_root( S->R, P ) < 0 )
+    return -1;
+
+  for( i = 0; i < PARALLELISM_DEGREE; ++i )
+    if( blake2sp_init_leaf( S->S[i], P, i ) < 0 ) return -1;
+
+  S->R->last_node = 1;
+  S->S[PARALLELISM_DEGREE - 1]->last_node = 1;
+
+  if( P->key_length )
+  {
+    uint8_t block[BLAKE2S_BLOCKBYTES];
+    memset( block, 0, BLAKE2S_BLOCKBYTES );
+    memcpy( block, key, P->key_length );
+
+    for( i = 0; i < PARALLELISM_DEGREE; ++i )
+      blake2s_update( S->S[i], block, BLAKE2S_BLOCKBYTES );
+
+    secure_zero_memory( block, BLAKE2S_BLOCKBYTES ); /* Burn the key from stack */
+  }
+
+  return 0;
+}
+
+
+int blake2sp_init( blake2sp_state *S, const uint8_t outlen )
+{
+  blake2s_param P[1];
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) return -1;
+
+  memset( P, 0, sizeof( P ) );
+  P->digest_length = outlen;
+  return blake2sp_init_param( S, P, NULL );
+}
+
+
+int blake2sp_init_key( blake2sp_state *S, const uint8_t outlen, const void *key, const uint8_t keylen )
+{
+  blake2s_param P[1];
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) return -1;
+
+  if( !key || !keylen || keylen > BLAKE2S_KEYBYTES ) return -1;
+
+  memset( P, 0, sizeof( P ) );
+  P->digest_length = outlen;
+  P->key_length = keylen;
+  return blake2sp_init_param( S, P, key );
+}
+
+
+int blake2sp_update( blake2sp_state *S, const uint8_t *in, uint64_t inlen )
+{
+  blake2s_state *leaves[PARALLELISM_DEGREE];
+  const uint8_t *blocks[PARALLELISM_DEGREE];
+  size_t left = S->buflen;
+  size_t fill = sizeof( S->buf ) - left;
+  uint64_t stripes;
+  size_t i;
+
+  for( i = 0; i < PARALLELISM_DEGREE; ++i )
+    leaves[i] = S->S[i];
+
+  if( left && inlen >= fill )
+  {
+    memcpy( S->buf + left, in, fill );
+
+    for( i = 0; i < PARALLELISM_DEGREE; ++i )
+      blocks[i] = S->buf + i * BLAKE2S_BLOCKBYTES;
+
+    blake2s_update_x8( leaves, blocks, 1, 0 );
+    in += fill;
+    inlen -= fill;
+    left = 0;
+  }
+
+  /* Leaf i gets every PARALLELISM_DEGREE-th block starting with block i. */
+  stripes = inlen / ( PARALLELISM_DEGREE * BLAKE2S_BLOCKBYTES );
+
+  if( stripes > 0 )
+  {
+    for( i = 0; i < PARALLELISM_DEGREE; ++i )
+      blocks[i] = in + i * BLAKE2S_BLOCKBYTES;
+
+    blake2s_update_x8( leaves, blocks, (size_t)stripes, PARALLELISM_DEGREE * BLAKE2S_BLOCKBYTES );
+  }
+
+  in += stripes * PARALLELISM_DEGREE * BLAKE2S_BLOCKBYTES;
+  inlen %= PARALLELISM_DEGREE * BLAKE2S_BLOCKBYTES;
+
+  if( inlen > 0 )
+    memcpy( S->buf + left, in, (size_t)inlen );
+
+  S->buflen = left + (size_t)inlen;
+  return 0;
+}
+
+
+int blake2sp_final( blake2sp_state *S, uint8_t *out, uint8_t outlen )
+{
+  uint8_t hash[PARALLELISM_DEGREE][BLAKE2S_OUTBYTES];
+  size_t i;
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) return -1;
+
+  for( i = 0; i < PARALLELISM_DEGREE; ++i )
+  {
+    if( S->buflen > i * BLAKE2S_BLOCKBYTES )
+    {
+      size_t left = S->buflen - i * BLAKE2S_BLOCKBYTES;
+
+      if( left > BLAKE2S_BLOCKBYTES ) left = BLAKE2S_BLOCKBYTES;
+
+      blake2s_update( S->S[i], S->buf + i * BLAKE2S_BLOCKBYTES, left );
+    }
+
+    blake2s_final( S->S[i], hash[i], BLAKE2S_OUTBYTES );
+  }
+
+  for( i = 0; i < PARALLELISM_DEGREE; ++i )
+    blake2s_update( S->R, hash[i], BLAKE2S_OUTBYTES );
+
+  blake2s_final( S->R, out, outlen );
+  secure_zero_memory( hash, sizeof( hash ) );
+  return 0;
+}
+
+
+int blake2sp( uint8_t *out, const void *in, const void *key, const uint8_t outlen, const uint64_t inlen, uint8_t keylen )
+{
+  blake2sp_state S[1];
+
+  /* Verify parameters */
+  if ( NULL == in && inlen > 0 ) return -1;
+
+  if ( NULL == out ) return -1;
+
+  if( NULL == key && keylen > 0 ) return -1;
+
+  if( !outlen || outlen > BLAKE2S_OUTBYTES ) return -1;
+
+  if( keylen > BLAKE2S_KEYBYTES ) return -1;
+
+  if( keylen > 0 )
+  {
+    if( blake2sp_init_key( S, outlen, key, keylen ) < 0 ) return -1;
+  }
+  else
+  {
+    if( blake2sp_init( S, outlen ) < 0 ) return -1;
+  }
+
+  blake2sp_update( S, ( const uint8_t * )in, inlen );
+  blake2sp_final( S, out, outlen );
+  return 0;
+}
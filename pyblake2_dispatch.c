@@ -0,0 +1,119 @@
+/*
+ * Runtime CPU feature detection.
+ */
+
+#include "pyblake2_impl_common.h"
+#include "pyblake2_dispatch.h"
+
+#ifdef PYBLAKE2_X86
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#else
+# include <cpuid.h>
+#endif
+
+static void
+cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#ifdef _MSC_VER
+    int r[4];
+
+    __cpuidex(r, (int)leaf, (int)subleaf);
+    regs[0] = r[0];
+    regs[1] = r[1];
+    regs[2] = r[2];
+    regs[3] = r[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* Returns XCR0, which tells which register states the OS saves. */
+static uint64_t
+xgetbv0(void)
+{
+#if defined(_MSC_VER) && _MSC_FULL_VER >= 160040219
+    return _xgetbv(0);
+#elif defined(_MSC_VER)
+    return 0; /* no _xgetbv before Visual Studio 2010 SP1 */
+#else
+    uint32_t eax, edx;
+
+    /* xgetbv, spelled out for old assemblers */
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0"
+                         : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+static unsigned int
+detect_features(void)
+{
+    uint32_t regs[4];
+    uint32_t max_leaf, max_ext_leaf;
+    unsigned int features = 0;
+
+    cpuid(0, 0, regs);
+    max_leaf = regs[0];
+    if (max_leaf < 1)
+        return 0;
+
+    cpuid(1, 0, regs);
+    if (regs[3] & (1u << 26))
+        features |= PYBLAKE2_CPU_SSE2;
+    if (regs[2] & (1u << 9))
+        features |= PYBLAKE2_CPU_SSSE3;
+    if (regs[2] & (1u << 19))
+        features |= PYBLAKE2_CPU_SSE41;
+
+    /* AVX needs both CPU support and the OS saving YMM registers. */
+    if ((regs[2] & (1u << 27)) && (regs[2] & (1u << 28)) &&
+            (xgetbv0() & 0x6) == 0x6) {
+        features |= PYBLAKE2_CPU_AVX;
+
+        if (max_leaf >= 7) {
+            cpuid(7, 0, regs);
+            if (regs[1] & (1u << 5))
+                features |= PYBLAKE2_CPU_AVX2;
+            /* AVX512F and AVX512VL, and the OS saving opmask and ZMM
+             * registers. */
+            if ((regs[1] & (1u << 16)) && (regs[1] & (1u << 31)) &&
+                    (xgetbv0() & 0xe6) == 0xe6)
+                features |= PYBLAKE2_CPU_AVX512;
+        }
+
+        cpuid(0x80000000, 0, regs);
+        max_ext_leaf = regs[0];
+        if (max_ext_leaf >= 0x80000001) {
+            cpuid(0x80000001, 0, regs);
+            if (regs[2] & (1u << 11))
+                features |= PYBLAKE2_CPU_XOP;
+        }
+    }
+
+    return features;
+}
+
+#else
+
+static unsigned int
+detect_features(void)
+{
+    return 0;
+}
+
+#endif /* !PYBLAKE2_X86 */
+
+unsigned int
+pyblake2_cpu_features(void)
+{
+    static int detected = 0;
+    static unsigned int features = 0;
+
+    if (!detected) {
+        features = detect_features();
+        detected = 1;
+    }
+    return features;
+}
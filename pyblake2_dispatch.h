@@ -0,0 +1,44 @@
+#ifndef PYBLAKE2_DISPATCH_H
+#define PYBLAKE2_DISPATCH_H
+
+/*
+ * CPU features used to select implementation variants.
+ */
+#define PYBLAKE2_CPU_SSE2   0x0001
+#define PYBLAKE2_CPU_SSSE3  0x0002
+#define PYBLAKE2_CPU_SSE41  0x0004
+#define PYBLAKE2_CPU_AVX    0x0008
+#define PYBLAKE2_CPU_XOP    0x0010
+#define PYBLAKE2_CPU_AVX2   0x0020
+#define PYBLAKE2_CPU_AVX512 0x0040 /* AVX512F and AVX512VL */
+
+/* Returns a mask of PYBLAKE2_CPU_* flags supported by the CPU and OS. */
+unsigned int pyblake2_cpu_features(void);
+
+/*
+ * Select the fastest variant supported by the given CPU features (or the
+ * one forced with BLAKE2_COMPRESS_* macro) for the public blake2b_* and
+ * blake2s_* functions, and multi-buffer kernels unless a variant is
+ * forced. Returns the name of the selected single-stream variant.
+ */
+const char *blake2b_select_impl(unsigned int features);
+const char *blake2s_select_impl(unsigned int features);
+
+/* Optimization choice support */
+#if defined(BLAKE2_COMPRESS_AVX512)
+# define BLAKE2_FORCED_VARIANT "avx512"
+#elif defined(BLAKE2_COMPRESS_XOP)
+# define BLAKE2_FORCED_VARIANT "xop"
+#elif defined(BLAKE2_COMPRESS_AVX)
+# define BLAKE2_FORCED_VARIANT "avx"
+#elif defined(BLAKE2_COMPRESS_SSE41)
+# define BLAKE2_FORCED_VARIANT "sse41"
+#elif defined(BLAKE2_COMPRESS_SSSE3)
+# define BLAKE2_FORCED_VARIANT "ssse3"
+#elif defined(BLAKE2_COMPRESS_SSE2)
+# define BLAKE2_FORCED_VARIANT "sse2"
+#elif defined(BLAKE2_COMPRESS_REGS)
+# define BLAKE2_FORCED_VARIANT "ref"
+#endif
+
+#endif /* PYBLAKE2_DISPATCH_H */
@@ -0,0 +1,1020 @@
+/*
+ * Reading files for hashing without the GIL.
+ */
+
+#include <Python.h> /* for large file support macros */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+# include <io.h>
+# include <windows.h> /* for MoveFileExA() */
+#else
+# include <unistd.h>
+# if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#  include <sys/mman.h>
+#  define PYBLAKE2_HAVE_MMAP
+# endif
+#endif
+
+/* io_uring reads need Linux 5.6 headers; the syscalls are made directly. */
+#if defined(__linux__) && defined(PYBLAKE2_HAVE_MMAP) && \
+    !defined(PYBLAKE2_NO_IO_URING) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <sys/syscall.h>
+#  include <linux/io_uring.h>
+#  if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#   define PYBLAKE2_HAVE_IO_URING
+#  endif
+# endif
+#endif
+
+#ifdef WITH_THREAD
+# include "pythread.h"
+#endif
+
+#include "pyblake2_file.h"
+#include "pyblake2_threads.h"
+
+/* Size of file regions mapped at once, a multiple of any page size. */
+#define MAP_SIZE ((size_t)1 << 28)
+
+/* Smaller files are read even if mapping is requested. */
+#define MAP_MINSIZE ((off_t)1 << 22)
+
+/* Size of reads when files can't be mapped. */
+#define READ_SIZE ((size_t)1 << 20)
+
+/*
+ * Alignment of read buffers. Page-aligned buffers let the kernel copy
+ * whole pages into them, and keep the pieces hashed from them aligned
+ * for vector loads.
+ */
+#define BUFFER_ALIGN ((size_t)4096)
+
+/* Allocate a read buffer, or return NULL. */
+static uint8_t *
+alloc_buffer(size_t size)
+{
+#ifdef _WIN32
+    return (uint8_t *)_aligned_malloc(size, BUFFER_ALIGN);
+#else
+    void *buf;
+
+    return posix_memalign(&buf, BUFFER_ALIGN, size) == 0 ? (uint8_t *)buf
+                                                         : NULL;
+#endif
+}
+
+static void
+free_buffer(uint8_t *buf)
+{
+#ifdef _WIN32
+    _aligned_free(buf);
+#else
+    free(buf);
+#endif
+}
+
+int
+pyblake2_open_file(const char *path)
+{
+#ifdef _WIN32
+    return _open(path, _O_RDONLY | _O_BINARY);
+#else
+    int flags = O_RDONLY, fd;
+
+# ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+# endif
+    do {
+        fd = open(path, flags);
+    } while (fd < 0 && errno == EINTR);
+    return fd;
+#endif
+}
+
+void
+pyblake2_close_file(int fd)
+{
+#ifdef _WIN32
+    _close(fd);
+#else
+    close(fd);
+#endif
+}
+
+int
+pyblake2_file_size(int fd, uint64_t *size)
+{
+#ifdef _WIN32
+    struct _stati64 st;
+
+    if (_fstati64(fd, &st) < 0)
+        return errno;
+#else
+    struct stat st;
+
+    if (fstat(fd, &st) < 0)
+        return errno;
+#endif
+    *size = (uint64_t)st.st_size;
+    return 0;
+}
+
+/* Write len bytes of data to fd at its current offset. */
+static int
+write_full(int fd, const uint8_t *data, size_t len)
+{
+#ifdef _WIN32
+    int n;
+#else
+    ssize_t n;
+#endif
+
+    while (len > 0) {
+#ifdef _WIN32
+        n = _write(fd, data, (unsigned int)(len < READ_SIZE ? len
+                                                             : READ_SIZE));
+#else
+        n = write(fd, data, len);
+#endif
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+int
+pyblake2_replace_file(const char *path, const uint8_t *data, size_t len)
+{
+    size_t pathlen = strlen(path);
+    char *tmp;
+    int fd, err;
+
+    if ((tmp = (char *)malloc(pathlen + 8)) == NULL)
+        return ENOMEM;
+    memcpy(tmp, path, pathlen);
+    memcpy(tmp + pathlen, ".XXXXXX", 8);
+
+#ifdef _WIN32
+    if ((err = _mktemp_s(tmp, pathlen + 8)) != 0) {
+        free(tmp);
+        return err;
+    }
+    fd = _open(tmp, _O_WRONLY | _O_BINARY | _O_CREAT | _O_EXCL,
+               _S_IREAD | _S_IWRITE);
+#else
+    /* mkstemp() creates the file accessible to its owner only. */
+    fd = mkstemp(tmp);
+#endif
+    if (fd < 0) {
+        err = errno;
+        free(tmp);
+        return err;
+    }
+
+    err = write_full(fd, data, len);
+#ifdef _WIN32
+    if (err == 0 && _commit(fd) < 0)
+        err = errno;
+    pyblake2_close_file(fd);
+    if (err == 0 && !MoveFileExA(tmp, path, MOVEFILE_REPLACE_EXISTING))
+        err = EACCES;
+    if (err != 0)
+        _unlink(tmp);
+#else
+    if (err == 0 && fsync(fd) < 0)
+        err = errno;
+    pyblake2_close_file(fd);
+    if (err == 0 && rename(tmp, path) < 0)
+        err = errno;
+    if (err != 0)
+        unlink(tmp);
+#endif
+    free(tmp);
+    return err;
+}
+
+#ifdef _WIN32
+
+/* Read fd from the current offset until end of file. */
+static int
+read_file(int fd, pyblake2_data_fn fn, void *arg)
+{
+    uint8_t *buf;
+    int n, err = 0;
+
+    if ((buf = alloc_buffer(READ_SIZE)) == NULL)
+        return ENOMEM;
+    while ((n = _read(fd, buf, (unsigned int)READ_SIZE)) > 0)
+        fn(arg, buf, (size_t)n);
+    if (n < 0)
+        err = errno;
+    free_buffer(buf);
+    return err;
+}
+
+int
+pyblake2_read_file(int fd, unsigned int depth, int use_mmap,
+                   pyblake2_data_fn fn, void *arg)
+{
+    struct _stati64 st;
+
+    if (_fstati64(fd, &st) < 0)
+        return errno;
+    if ((st.st_mode & _S_IFMT) == _S_IFREG && _lseeki64(fd, 0, SEEK_SET) < 0)
+        return errno;
+    return read_file(fd, fn, arg);
+}
+
+int
+pyblake2_read_file_from(int fd, uint64_t offset, pyblake2_data_fn fn,
+                        void *arg)
+{
+    if (_lseeki64(fd, (__int64)offset, SEEK_SET) < 0)
+        return errno;
+    return read_file(fd, fn, arg);
+}
+
+#else /* !_WIN32 */
+
+/* Read fd until end of file, starting at offset if seekable. */
+static int
+read_file(int fd, off_t offset, int seekable,
+          pyblake2_data_fn fn, void *arg)
+{
+    uint8_t *buf;
+    ssize_t n;
+    int err = 0;
+
+    if ((buf = alloc_buffer(READ_SIZE)) == NULL)
+        return ENOMEM;
+
+    for (;;) {
+        if (seekable)
+            n = pread(fd, buf, READ_SIZE, offset);
+        else
+            n = read(fd, buf, READ_SIZE);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            err = errno;
+            break;
+        }
+        if (n == 0)
+            break;
+        fn(arg, buf, (size_t)n);
+        offset += n;
+    }
+
+    free_buffer(buf);
+    return err;
+}
+
+#ifdef PYBLAKE2_HAVE_MMAP
+/*
+ * Map and hash the first size bytes of fd, returning the offset up to
+ * which it was done: the rest is read if mapping fails. (As with other
+ * uses of mmap, truncating the file meanwhile crashes the process with
+ * SIGBUS, which is why mapping is only done on request.)
+ */
+static off_t
+map_file(int fd, off_t size, pyblake2_data_fn fn, void *arg)
+{
+    off_t offset;
+    size_t len;
+    void *p;
+
+    for (offset = 0; offset < size; offset += len) {
+        len = (size - offset > (off_t)MAP_SIZE) ? MAP_SIZE
+                                                : (size_t)(size - offset);
+        p = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, offset);
+        if (p == MAP_FAILED)
+            break;
+# ifdef MADV_SEQUENTIAL
+        madvise(p, len, MADV_SEQUENTIAL);
+# endif
+        fn(arg, (const uint8_t *)p, len);
+        munmap(p, len);
+    }
+    return offset;
+}
+#endif
+
+/*
+ * Queued reads.
+ *
+ * With a queue depth, regular files are read in READ_SIZE pieces into
+ * one buffer per queue slot, piece k going to slot k % depth, so up to
+ * depth reads are in flight while the oldest one is hashed. That keeps
+ * fast storage busy when each synchronous read would wait for its own
+ * round trip. io_uring is used where the kernel supports it, and reader
+ * threads calling pread() otherwise. Both functions hash pieces in order
+ * and set *done to the offset up to which the file was hashed; they stop
+ * after a short read, leaving the rest (if any) to read_file(). They
+ * return -1 before hashing anything if they can't be used.
+ */
+
+/* Read up to size bytes at offset, stopping early only at end of file. */
+static size_t
+pread_full(int fd, uint8_t *buf, size_t size, off_t offset, int *err)
+{
+    size_t done = 0;
+    ssize_t n;
+
+    while (done < size) {
+        n = pread(fd, buf + done, size - done, offset + (off_t)done);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            *err = errno;
+            break;
+        }
+        if (n == 0)
+            break;
+        done += (size_t)n;
+    }
+    return done;
+}
+
+static uint64_t
+count_pieces(off_t size)
+{
+    return ((uint64_t)size + READ_SIZE - 1) / READ_SIZE;
+}
+
+#ifdef PYBLAKE2_HAVE_IO_URING
+/* Submission and completion rings shared with the kernel. */
+typedef struct {
+    int fd;
+    void *sq_ring, *cq_ring, *sqe_ring;
+    size_t sq_ring_size, cq_ring_size, sqe_ring_size;
+    unsigned int *sq_tail, *sq_mask, *sq_array;
+    unsigned int *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    unsigned int sq_entries, unsubmitted;
+} uring;
+
+static void
+uring_close(uring *r)
+{
+    if (r->sqe_ring != MAP_FAILED)
+        munmap(r->sqe_ring, r->sqe_ring_size);
+    if (r->cq_ring != MAP_FAILED)
+        munmap(r->cq_ring, r->cq_ring_size);
+    if (r->sq_ring != MAP_FAILED)
+        munmap(r->sq_ring, r->sq_ring_size);
+    close(r->fd);
+}
+
+static void *
+uring_map(uring *r, size_t size, off_t offset)
+{
+    return mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, r->fd,
+                offset);
+}
+
+/* Returns 0 if io_uring isn't available or lacks IORING_OP_READ. */
+static int
+uring_setup(uring *r, unsigned int entries)
+{
+    struct io_uring_params p;
+    char *sq, *cq;
+
+    memset(&p, 0, sizeof(p));
+    r->fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (r->fd < 0)
+        return 0;
+    r->sq_ring = r->cq_ring = r->sqe_ring = MAP_FAILED;
+    /* Added in the same kernel release as IORING_OP_READ (5.6). */
+    if (!(p.features & IORING_FEAT_RW_CUR_POS))
+        goto fail;
+
+    r->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+    r->cq_ring_size = p.cq_off.cqes +
+                      p.cq_entries * sizeof(struct io_uring_cqe);
+    r->sqe_ring_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sq_ring = uring_map(r, r->sq_ring_size, IORING_OFF_SQ_RING);
+    r->cq_ring = uring_map(r, r->cq_ring_size, IORING_OFF_CQ_RING);
+    r->sqe_ring = uring_map(r, r->sqe_ring_size, IORING_OFF_SQES);
+    if (r->sq_ring == MAP_FAILED || r->cq_ring == MAP_FAILED ||
+            r->sqe_ring == MAP_FAILED)
+        goto fail;
+
+    sq = (char *)r->sq_ring;
+    cq = (char *)r->cq_ring;
+    r->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+    r->sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+    r->sq_array = (unsigned int *)(sq + p.sq_off.array);
+    r->cq_head = (unsigned int *)(cq + p.cq_off.head);
+    r->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+    r->cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+    r->sqes = (struct io_uring_sqe *)r->sqe_ring;
+    r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    r->sq_entries = p.sq_entries;
+    r->unsubmitted = 0;
+    return 1;
+
+fail:
+    uring_close(r);
+    return 0;
+}
+
+/* Marks slots whose reads haven't completed. */
+#define READ_PENDING INT_MIN
+
+/* user_data of cancel requests, whose completions aren't reads. */
+#define URING_CANCEL ((uint64_t)-1)
+
+/* Return a cleared entry at the tail of the submission queue. */
+static struct io_uring_sqe *
+uring_get_sqe(uring *r)
+{
+    unsigned int index = *r->sq_tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    r->sq_array[index] = index;
+    return sqe;
+}
+
+/* Queue the entry returned by uring_get_sqe() for submission. */
+static void
+uring_push_sqe(uring *r)
+{
+    /* The kernel must see the entry before the new tail. */
+    __atomic_store_n(r->sq_tail, *r->sq_tail + 1, __ATOMIC_RELEASE);
+    r->unsubmitted++;
+}
+
+static void
+uring_prep_read(uring *r, int fd, uint8_t *buf, off_t offset,
+                unsigned int slot)
+{
+    struct io_uring_sqe *sqe = uring_get_sqe(r);
+
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)buf;
+    sqe->len = (uint32_t)READ_SIZE;
+    sqe->off = (uint64_t)offset;
+    sqe->user_data = slot;
+    uring_push_sqe(r);
+}
+
+/* Queue cancellation of the read for each slot given as pending. */
+static void
+uring_prep_cancel(uring *r, const int *results, unsigned int depth)
+{
+    struct io_uring_sqe *sqe;
+    unsigned int slot;
+
+    for (slot = 0; slot < depth && r->unsubmitted < r->sq_entries; slot++) {
+        if (results[slot] != READ_PENDING)
+            continue;
+        sqe = uring_get_sqe(r);
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = slot;
+        sqe->user_data = URING_CANCEL;
+        uring_push_sqe(r);
+    }
+}
+
+/* Submit prepared reads and wait for a completion; returns 0 or errno. */
+static int
+uring_wait(uring *r)
+{
+    int n;
+
+    for (;;) {
+        n = (int)syscall(__NR_io_uring_enter, r->fd, r->unsubmitted, 1,
+                         IORING_ENTER_GETEVENTS, NULL, 0);
+        if (n >= 0) {
+            r->unsubmitted -= (unsigned int)n;
+            return 0;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            return errno;
+    }
+}
+
+/* Store results of completed reads by slot; returns how many there were. */
+static unsigned int
+uring_reap(uring *r, int *results)
+{
+    unsigned int head = *r->cq_head, count = 0;
+    struct io_uring_cqe *cqe;
+
+    while (head != __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) {
+        cqe = &r->cqes[head & *r->cq_mask];
+        if (cqe->user_data != URING_CANCEL) {
+            results[cqe->user_data] = cqe->res;
+            count++;
+        }
+        head++;
+    }
+    __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+    return count;
+}
+
+static int
+uring_read_file(int fd, off_t size, unsigned int depth,
+                pyblake2_data_fn fn, void *arg, off_t *done)
+{
+    uint64_t npieces = count_pieces(size), next = 0, k = 0;
+    unsigned int slot, inflight = 0;
+    uint8_t *bufs;
+    int *results;
+    int res, err = 0;
+    uring r;
+
+    if ((uint64_t)depth > npieces)
+        depth = (unsigned int)npieces;
+    if (depth == 0)
+        return 0;
+    bufs = alloc_buffer(depth * READ_SIZE);
+    results = (int *)malloc(depth * sizeof(int));
+    if (bufs == NULL || results == NULL || !uring_setup(&r, depth)) {
+        free_buffer(bufs);
+        free(results);
+        return -1;
+    }
+
+    for (next = 0; next < depth; next++) {
+        results[next] = READ_PENDING;
+        uring_prep_read(&r, fd, bufs + next * READ_SIZE,
+                        (off_t)(next * READ_SIZE), (unsigned int)next);
+    }
+    inflight = depth;
+
+    while (k < npieces) {
+        slot = (unsigned int)(k % depth);
+        while (results[slot] == READ_PENDING) {
+            if ((err = uring_wait(&r)) != 0)
+                break;
+            inflight -= uring_reap(&r, results);
+        }
+        if (err != 0)
+            break;
+
+        res = results[slot];
+        results[slot] = READ_PENDING;
+        if (res == -EINTR || res == -EAGAIN) {
+            uring_prep_read(&r, fd, bufs + slot * READ_SIZE,
+                            (off_t)(k * READ_SIZE), slot);
+            inflight++;
+            continue;
+        }
+        if (res < 0) {
+            err = -res;
+            break;
+        }
+        fn(arg, bufs + slot * READ_SIZE, (size_t)res);
+        *done += res;
+        if ((size_t)res < READ_SIZE)
+            break;
+
+        k++;
+        if (next < npieces) {
+            uring_prep_read(&r, fd, bufs + slot * READ_SIZE,
+                            (off_t)(next * READ_SIZE), slot);
+            inflight++;
+            next++;
+        }
+    }
+
+    /*
+     * Buffers can't be freed while the kernel may still write to them. If
+     * waiting fails, the reads are cancelled and waited for once more;
+     * buffers of reads still in flight after that are leaked.
+     */
+    while (inflight > 0 && uring_wait(&r) == 0)
+        inflight -= uring_reap(&r, results);
+    if (inflight > 0) {
+        uring_prep_cancel(&r, results, depth);
+        while (inflight > 0 && uring_wait(&r) == 0)
+            inflight -= uring_reap(&r, results);
+    }
+    uring_close(&r);
+    if (inflight == 0)
+        free_buffer(bufs);
+    free(results);
+    return err;
+}
+#endif /* PYBLAKE2_HAVE_IO_URING */
+
+#ifdef WITH_THREAD
+/*
+ * Each reader thread takes the next piece and waits for its slot to be
+ * emptied while holding the order lock, so slots are refilled in order
+ * of pieces; filled[slot] is released when the read is done. Once stop
+ * is set, readers just mark their pieces as empty.
+ */
+typedef struct {
+    int fd;
+    unsigned int depth;
+    uint64_t npieces, next;
+    uint8_t *bufs;
+    size_t *lens;
+    int *errs;
+    int stop;
+    unsigned int running;       /* threads that haven't finished yet */
+    PyThread_type_lock order;   /* protects next */
+    PyThread_type_lock mutex;   /* protects stop and running */
+    PyThread_type_lock done;    /* held until the last thread finishes */
+    PyThread_type_lock *filled, *emptied;
+} queue_job;
+
+static void
+queue_reader(void *p)
+{
+    queue_job *job = (queue_job *)p;
+    unsigned int slot = 0;
+    uint64_t k;
+    int stop, last;
+
+    for (;;) {
+        PyThread_acquire_lock(job->order, 1);
+        k = job->next;
+        if (k < job->npieces) {
+            job->next++;
+            slot = (unsigned int)(k % job->depth);
+            PyThread_acquire_lock(job->emptied[slot], 1);
+        }
+        PyThread_release_lock(job->order);
+        if (k >= job->npieces)
+            break;
+
+        PyThread_acquire_lock(job->mutex, 1);
+        stop = job->stop;
+        PyThread_release_lock(job->mutex);
+
+        job->lens[slot] = 0;
+        job->errs[slot] = 0;
+        if (!stop)
+            job->lens[slot] = pread_full(job->fd,
+                                         job->bufs + slot * READ_SIZE,
+                                         READ_SIZE, (off_t)(k * READ_SIZE),
+                                         &job->errs[slot]);
+        PyThread_release_lock(job->filled[slot]);
+    }
+
+    PyThread_acquire_lock(job->mutex, 1);
+    last = (--job->running == 0);
+    PyThread_release_lock(job->mutex);
+
+    if (last)
+        PyThread_release_lock(job->done);
+}
+
+static int
+threaded_read_file(int fd, off_t size, unsigned int depth,
+                   pyblake2_data_fn fn, void *arg, off_t *done)
+{
+    queue_job job;
+    PyThread_type_lock *locks;
+    unsigned int i, nlocks, started = 0, slot;
+    uint64_t k;
+    int stop = 0, err = 0, last;
+
+    job.npieces = count_pieces(size);
+    if ((uint64_t)depth > job.npieces)
+        depth = (unsigned int)job.npieces;
+    if (depth == 0)
+        return 0;
+
+    nlocks = 2 * depth + 3;
+    job.bufs = alloc_buffer(depth * READ_SIZE);
+    job.lens = (size_t *)malloc(depth * sizeof(size_t));
+    job.errs = (int *)malloc(depth * sizeof(int));
+    locks = (PyThread_type_lock *)calloc(nlocks, sizeof(PyThread_type_lock));
+    if (job.bufs == NULL || job.lens == NULL || job.errs == NULL ||
+            locks == NULL) {
+        err = -1;
+        goto cleanup;
+    }
+    for (i = 0; i < nlocks; i++) {
+        if ((locks[i] = PyThread_allocate_lock()) == NULL) {
+            err = -1;
+            goto cleanup;
+        }
+    }
+
+    job.fd = fd;
+    job.depth = depth;
+    job.next = 0;
+    job.stop = 0;
+    job.order = locks[0];
+    job.mutex = locks[1];
+    job.done = locks[2];
+    job.filled = locks + 3;
+    job.emptied = locks + 3 + depth;
+    for (i = 0; i < depth; i++)
+        PyThread_acquire_lock(job.filled[i], 1);
+    /* As in pyblake2_parallel_for(), the calling thread counts as
+     * running, so done can't be released while threads are started. */
+    job.running = 1;
+    PyThread_acquire_lock(job.done, 1);
+    for (i = 0; i < depth; i++) {
+        PyThread_acquire_lock(job.mutex, 1);
+        job.running++;
+        PyThread_release_lock(job.mutex);
+        if (!pyblake2_run_thread(queue_reader, &job)) {
+            PyThread_acquire_lock(job.mutex, 1);
+            job.running--;
+            PyThread_release_lock(job.mutex);
+            break;
+        }
+        started++;
+    }
+
+    /* Without readers, no slot is ever filled. */
+    for (k = 0; started > 0 && k < job.npieces; k++) {
+        slot = (unsigned int)(k % depth);
+        PyThread_acquire_lock(job.filled[slot], 1);
+        if (!stop) {
+            if (job.errs[slot] != 0) {
+                err = job.errs[slot];
+                stop = 1;
+            }
+            else {
+                fn(arg, job.bufs + slot * READ_SIZE, job.lens[slot]);
+                *done += (off_t)job.lens[slot];
+                stop = job.lens[slot] < READ_SIZE;
+            }
+            if (stop) {
+                PyThread_acquire_lock(job.mutex, 1);
+                job.stop = 1;
+                PyThread_release_lock(job.mutex);
+            }
+        }
+        PyThread_release_lock(job.emptied[slot]);
+    }
+
+    PyThread_acquire_lock(job.mutex, 1);
+    last = (--job.running == 0);
+    PyThread_release_lock(job.mutex);
+    if (last)
+        PyThread_release_lock(job.done);
+    PyThread_acquire_lock(job.done, 1);
+    PyThread_release_lock(job.done);
+    if (started == 0)
+        err = -1;
+
+cleanup:
+    if (locks != NULL) {
+        for (i = 0; i < nlocks; i++) {
+            if (locks[i] != NULL)
+                PyThread_free_lock(locks[i]);
+        }
+    }
+    free(locks);
+    free(job.errs);
+    free(job.lens);
+    free_buffer(job.bufs);
+    return err;
+}
+#endif /* WITH_THREAD */
+
+/* Hash fd with queued reads as far as possible; see above. */
+static int
+queue_read_file(int fd, off_t size, unsigned int depth,
+                pyblake2_data_fn fn, void *arg, off_t *done)
+{
+    int err = -1;
+
+#ifdef PYBLAKE2_HAVE_IO_URING
+    err = uring_read_file(fd, size, depth, fn, arg, done);
+#endif
+#ifdef WITH_THREAD
+    if (err < 0)
+        err = threaded_read_file(fd, size, depth, fn, arg, done);
+#endif
+    return err;
+}
+
+int
+pyblake2_read_file(int fd, unsigned int depth, int use_mmap,
+                   pyblake2_data_fn fn, void *arg)
+{
+    struct stat st;
+    off_t offset = 0;
+    int err = -1;
+
+    if (fstat(fd, &st) < 0)
+        return errno;
+    if (!S_ISREG(st.st_mode))
+        return read_file(fd, 0, 0, fn, arg);
+
+    if (depth > 0 &&
+            (err = queue_read_file(fd, st.st_size, depth, fn, arg,
+                                   &offset)) > 0)
+        return err;
+#ifdef PYBLAKE2_HAVE_MMAP
+    if (err < 0 && use_mmap && st.st_size >= MAP_MINSIZE)
+        offset = map_file(fd, st.st_size, fn, arg);
+#else
+    (void)use_mmap;
+#endif
+    /* Read the rest, including data appended since fstat(). */
+    return read_file(fd, offset, 1, fn, arg);
+}
+
+int
+pyblake2_read_file_from(int fd, uint64_t offset, pyblake2_data_fn fn,
+                        void *arg)
+{
+# ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, (off_t)offset, 0, POSIX_FADV_SEQUENTIAL);
+# endif
+    return read_file(fd, (off_t)offset, 1, fn, arg);
+}
+
+#endif /* !_WIN32 */
+
+/*
+ * Streaming.
+ */
+
+/* Read up to size bytes, stopping early only at end of file or error. */
+static size_t
+read_full(int fd, uint8_t *buf, size_t size, int *err)
+{
+    size_t done = 0;
+#ifdef _WIN32
+    int n;
+#else
+    ssize_t n;
+#endif
+
+    while (done < size) {
+#ifdef _WIN32
+        n = _read(fd, buf + done, (unsigned int)(size - done));
+#else
+        n = read(fd, buf + done, size - done);
+#endif
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            *err = errno;
+            break;
+        }
+        if (n == 0)
+            break;
+        done += (size_t)n;
+    }
+    return done;
+}
+
+static size_t
+next_piece(uint64_t left, size_t bufsize)
+{
+    return left < (uint64_t)bufsize ? (size_t)left : bufsize;
+}
+
+static int
+stream_sequential(int fd, uint64_t length, size_t bufsize,
+                  pyblake2_data_fn fn, void *arg, uint64_t *nread)
+{
+    uint8_t *buf;
+    size_t n;
+    int err = 0;
+
+    if ((buf = alloc_buffer(bufsize)) == NULL)
+        return ENOMEM;
+    while (length > 0 && err == 0 &&
+           (n = read_full(fd, buf, next_piece(length, bufsize), &err)) > 0) {
+        fn(arg, buf, n);
+        *nread += n;
+        length -= n;
+    }
+    free_buffer(buf);
+    return err;
+}
+
+#ifdef WITH_THREAD
+/*
+ * Buffers are passed between the reader thread and the hashing thread
+ * with locks used as binary semaphores: filled[i] is released when buffer
+ * i has data (an empty buffer marks the end), and emptied[i] when it can
+ * be reused.
+ */
+typedef struct {
+    int fd;
+    uint64_t left;
+    size_t bufsize;
+    uint8_t *buf[2];
+    size_t len[2];
+    int err;
+    PyThread_type_lock filled[2], emptied[2], done;
+} stream_job;
+
+static void
+stream_reader(void *p)
+{
+    stream_job *job = (stream_job *)p;
+    unsigned int i = 0;
+    size_t n;
+
+    do {
+        PyThread_acquire_lock(job->emptied[i], 1);
+        n = 0;
+        if (job->left > 0 && job->err == 0)
+            n = read_full(job->fd, job->buf[i],
+                          next_piece(job->left, job->bufsize), &job->err);
+        job->left -= n;
+        job->len[i] = n;
+        PyThread_release_lock(job->filled[i]);
+        i ^= 1;
+    } while (n > 0);
+
+    PyThread_release_lock(job->done);
+}
+#endif
+
+int
+pyblake2_stream_fd(int fd, uint64_t length, size_t bufsize,
+                   pyblake2_data_fn fn, void *arg, uint64_t *nread)
+{
+#ifdef WITH_THREAD
+    PyThread_type_lock *locks[5];
+    stream_job job;
+    unsigned int i;
+    int ok = 1;
+#endif
+
+    *nread = 0;
+#ifdef POSIX_FADV_SEQUENTIAL
+    /* Fails harmlessly for pipes and sockets. */
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+#ifdef WITH_THREAD
+    /* Reading in another thread doesn't pay off for a single piece. */
+    if (length <= (uint64_t)bufsize)
+        return stream_sequential(fd, length, bufsize, fn, arg, nread);
+
+    locks[0] = &job.filled[0];
+    locks[1] = &job.filled[1];
+    locks[2] = &job.emptied[0];
+    locks[3] = &job.emptied[1];
+    locks[4] = &job.done;
+    for (i = 0; i < 5; i++) {
+        if ((*locks[i] = PyThread_allocate_lock()) == NULL)
+            ok = 0;
+    }
+    job.buf[0] = alloc_buffer(bufsize);
+    job.buf[1] = alloc_buffer(bufsize);
+    if (job.buf[0] == NULL || job.buf[1] == NULL)
+        ok = 0;
+
+    if (ok) {
+        job.fd = fd;
+        job.left = length;
+        job.bufsize = bufsize;
+        job.err = 0;
+        PyThread_acquire_lock(job.filled[0], 1);
+        PyThread_acquire_lock(job.filled[1], 1);
+        PyThread_acquire_lock(job.done, 1);
+        ok = pyblake2_run_thread(stream_reader, &job);
+    }
+
+    if (ok) {
+        for (i = 0; ; i ^= 1) {
+            PyThread_acquire_lock(job.filled[i], 1);
+            if (job.len[i] == 0)
+                break;
+            fn(arg, job.buf[i], job.len[i]);
+            *nread += job.len[i];
+            PyThread_release_lock(job.emptied[i]);
+        }
+        PyThread_acquire_lock(job.done, 1);
+    }
+
+    for (i = 0; i < 5; i++) {
+        if (*locks[i] != NULL)
+            PyThread_free_lock(*locks[i]);
+    }
+    free_buffer(job.buf[0]);
+    free_buffer(job.buf[1]);
+    if (ok)
+        return job.err;
+#endif
+
+    return stream_sequential(fd, length, bufsize, fn, arg, nread);
+}
@@ -0,0 +1,64 @@
+#ifndef PYBLAKE2_FILE_H
+#define PYBLAKE2_FILE_H
+
+#include <stddef.h>
+
+#include "pyblake2_impl_common.h"
+
+/* Called with consecutive pieces of file data. */
+typedef void (*pyblake2_data_fn)(void *arg, const uint8_t *data, size_t len);
+
+/* Opens path for reading; returns a file descriptor, or -1 and sets errno. */
+int pyblake2_open_file(const char *path);
+
+void pyblake2_close_file(int fd);
+
+/* Stores the size of the file open as fd in *size; returns 0 or errno. */
+int pyblake2_file_size(int fd, uint64_t *size);
+
+/*
+ * Replace the file at path with len bytes of data, which are written to a
+ * new file accessible to its owner only and renamed to path, so that the
+ * file never has partial contents; returns 0, or an errno value.
+ */
+int pyblake2_replace_file(const char *path, const uint8_t *data, size_t len);
+
+/*
+ * Call fn(arg, data, len) for the contents of the file open as fd, and
+ * return 0, or an errno value on error. Regular files are read from the
+ * beginning, without changing the file offset on POSIX systems, in large
+ * pieces with pread(). If use_mmap is nonzero, files of a few megabytes or
+ * more are memory-mapped for sequential access instead where possible;
+ * truncating such a file while it's hashed then kills the process with
+ * SIGBUS. If depth is nonzero, regular files are instead read keeping up
+ * to depth reads in flight, with io_uring on Linux or reader threads
+ * elsewhere (depth and use_mmap are ignored on Windows). Other files, such
+ * as pipes, are read from the current offset. Doesn't use Python API, so
+ * the caller should release the GIL.
+ */
+int pyblake2_read_file(int fd, unsigned int depth, int use_mmap,
+                       pyblake2_data_fn fn, void *arg);
+
+/*
+ * Call fn(arg, data, len) for the contents of the regular file open as fd
+ * from offset until end of file, and return 0, or an errno value. Doesn't
+ * use Python API.
+ */
+int pyblake2_read_file_from(int fd, uint64_t offset, pyblake2_data_fn fn,
+                            void *arg);
+
+/* Length of pyblake2_stream_fd() reads that go on until end of file. */
+#define PYBLAKE2_UNTIL_EOF ((uint64_t)-1)
+
+/*
+ * Call fn(arg, data, len) for up to length bytes read from fd at its
+ * current offset, until end of file, in pieces of bufsize bytes. Each
+ * piece is read by another native thread while the previous one is
+ * passed to fn. Stores the number of bytes passed to fn in *nread, and
+ * returns 0, or an errno value. Doesn't use Python API, so the caller
+ * should release the GIL.
+ */
+int pyblake2_stream_fd(int fd, uint64_t length, size_t bufsize,
+                       pyblake2_data_fn fn, void *arg, uint64_t *nread);
+
+#endif /* PYBLAKE2_FILE_H */
@@ -9,42 +9,55 @@
 # endif
 #endif
 
-/* Optimization choice support */
-#if defined(BLAKE2_COMPRESS_XOP)
-# define HAVE_XOP
-# define USE_OPTIMIZED_IMPL
-#elif defined(BLAKE2_COMPRESS_AVX)
-# define HAVE_AVX
-# define USE_OPTIMIZED_IMPL
-#elif defined(BLAKE2_COMPRESS_SSSE3)
-# define HAVE_SSSE3
-# define USE_OPTIMIZED_IMPL
-#elif defined(BLAKE2_COMPRESS_SSE2)
-# define HAVE_SSE2
-# define USE_OPTIMIZED_IMPL
-#elif defined(BLAKE2_COMPRESS_AUTO)
-
-/* Auto-detect optimization based on CFLAGS (from upstream) */
-# if defined(__SSE2__) || defined(__x86_64__) || defined(__amd64__)
-#  define HAVE_SSE2
-# endif
-# if defined(__SSSE3__)
-#  define HAVE_SSSE3
+/* Architectures for which optimized variants are built */
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__) || \
+    defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86)
+# define PYBLAKE2_X86
+/* <immintrin.h> first appeared in Visual Studio 2010 */
+# if !defined(_MSC_VER) || _MSC_VER >= 1600
+#  define PYBLAKE2_HAVE_AVX_VARIANT
 # endif
-# if defined(__SSE4_1__)
-#  define HAVE_SSE41
+/* AVX2 intrinsics are supported since Visual Studio 2013 */
+# if !defined(_MSC_VER) || _MSC_VER >= 1800
+#  define PYBLAKE2_HAVE_AVX2_VARIANT
 # endif
-# if defined(__AVX__)
-#  define HAVE_AVX
+/* AVX-512 intrinsics are supported since Visual Studio 2017 */
+# if !defined(_MSC_VER) || _MSC_VER >= 1910
+#  define PYBLAKE2_HAVE_AVX512_VARIANT
 # endif
-# if defined(__XOP__)
-#  define HAVE_XOP
+/* XOP intrinsics are declared in <x86intrin.h>, which MSVC lacks */
+# ifndef _MSC_VER
+#  define PYBLAKE2_HAVE_XOP_VARIANT
 # endif
+#endif
 
-/* pure SSE2 implementation is very slow, so only use the more optimized SSSE3+
- * https://github.com/dchest/pyblake2/issues/11 */
-# if defined(__SSSE3__) || defined(__SSE4_1__) || defined(__AVX__) || defined(__XOP__)
-#  define USE_OPTIMIZED_IMPL
-# endif
+/*
+ * Runtime dispatch support.
+ *
+ * Each implementation variant is compiled in its own translation unit,
+ * which defines BLAKE2_IMPL_VARIANT to the variant name (e.g. sse41) and
+ * the corresponding HAVE_* macro before including this file. Public
+ * functions from impl/ then get the variant name as a suffix, and
+ * blake2b_impl.c/blake2s_impl.c pick one of them at module import.
+ */
+#ifdef BLAKE2_IMPL_VARIANT
+# define BLAKE2_VARIANT_NAME__(name, variant) name##_##variant
+# define BLAKE2_VARIANT_NAME_(name, variant)  BLAKE2_VARIANT_NAME__(name, variant)
+# define BLAKE2_VARIANT_NAME(name) BLAKE2_VARIANT_NAME_(name, BLAKE2_IMPL_VARIANT)
+
+# define blake2b_init_param BLAKE2_VARIANT_NAME(blake2b_init_param)
+# define blake2b_init       BLAKE2_VARIANT_NAME(blake2b_init)
+# define blake2b_init_key   BLAKE2_VARIANT_NAME(blake2b_init_key)
+# define blake2b_update     BLAKE2_VARIANT_NAME(blake2b_update)
+# define blake2b_flush      BLAKE2_VARIANT_NAME(blake2b_flush)
+# define blake2b_final      BLAKE2_VARIANT_NAME(blake2b_final)
+# define blake2b            BLAKE2_VARIANT_NAME(blake2b)
 
+# define blake2s_init_param BLAKE2_VARIANT_NAME(blake2s_init_param)
+# define blake2s_init       BLAKE2_VARIANT_NAME(blake2s_init)
+# define blake2s_init_key   BLAKE2_VARIANT_NAME(blake2s_init_key)
+# define blake2s_update     BLAKE2_VARIANT_NAME(blake2s_update)
+# define blake2s_flush      BLAKE2_VARIANT_NAME(blake2s_flush)
+# define blake2s_final      BLAKE2_VARIANT_NAME(blake2s_final)
+# define blake2s            BLAKE2_VARIANT_NAME(blake2s)
 #endif
@@ -0,0 +1,288 @@
+/*
+ * Native worker threads for parallel hashing.
+ */
+
+#include <Python.h>
+
+#include "pyblake2_threads.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <unistd.h>
+#endif
+
+unsigned int
+pyblake2_cpu_count(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (unsigned int)count : 1;
+#else
+    return 1;
+#endif
+}
+
+#ifdef WITH_THREAD
+# include "pythread.h"
+# ifndef _WIN32
+#  include <pthread.h> /* for pthread_atfork() */
+# endif
+
+# ifdef PYTHREAD_INVALID_THREAD_ID
+#  define THREAD_START_FAILED(id) ((id) == PYTHREAD_INVALID_THREAD_ID)
+# else
+#  define THREAD_START_FAILED(id) ((id) == -1)
+# endif
+
+static int
+start_thread(void (*fn)(void *arg), void *arg)
+{
+    return !THREAD_START_FAILED(PyThread_start_new_thread(fn, arg));
+}
+
+/* Number of ranges each thread gets on average, for load balancing. */
+#define RANGES_PER_THREAD 8
+
+typedef struct {
+    void (*fn)(void *arg, size_t start, size_t end);
+    void *arg;
+    size_t n, next, grain;
+    unsigned int running;       /* threads that haven't finished yet */
+    PyThread_type_lock mutex;   /* protects next and running */
+    PyThread_type_lock done;    /* held until the last thread finishes */
+} parallel_job;
+
+static void
+parallel_worker(void *p)
+{
+    parallel_job *job = (parallel_job *)p;
+    size_t start, end;
+    int last;
+
+    for (;;) {
+        PyThread_acquire_lock(job->mutex, 1);
+        start = job->next;
+        end = (job->n - start > job->grain) ? start + job->grain : job->n;
+        job->next = end;
+        PyThread_release_lock(job->mutex);
+
+        if (start == end)
+            break;
+        job->fn(job->arg, start, end);
+    }
+
+    PyThread_acquire_lock(job->mutex, 1);
+    last = (--job->running == 0);
+    PyThread_release_lock(job->mutex);
+
+    if (last)
+        PyThread_release_lock(job->done);
+}
+
+/*
+ * Pool of worker threads, started when first needed and then kept, so
+ * that calls don't pay for starting threads. Each worker waits on its own
+ * lock, which is released to hand it a function to run; idle workers are
+ * kept on a stack protected by pool_mutex. A forked child starts with an
+ * empty pool, as the workers only exist in the parent.
+ */
+
+/* Most threads kept in the pool; calls needing more use fewer threads. */
+#define POOL_MAXSIZE 256
+
+typedef struct pool_worker {
+    struct pool_worker *next;   /* next idle worker */
+    PyThread_type_lock wake;    /* held while the worker is idle */
+    void (*fn)(void *arg);
+    void *arg;
+} pool_worker;
+
+static PyThread_type_lock pool_mutex = NULL;
+static pool_worker *pool_idle = NULL;
+static unsigned int pool_size = 0;
+
+static void
+pool_thread(void *p)
+{
+    pool_worker *w = (pool_worker *)p;
+
+    for (;;) {
+        PyThread_acquire_lock(w->wake, 1);
+        w->fn(w->arg);
+
+        PyThread_acquire_lock(pool_mutex, 1);
+        w->next = pool_idle;
+        pool_idle = w;
+        PyThread_release_lock(pool_mutex);
+    }
+}
+
+/* Take an idle worker or start a new one; called with pool_mutex held. */
+static pool_worker *
+pool_get_worker(void)
+{
+    pool_worker *w = pool_idle;
+
+    if (w != NULL) {
+        pool_idle = w->next;
+        return w;
+    }
+    if (pool_size >= POOL_MAXSIZE)
+        return NULL;
+
+    if ((w = (pool_worker *)malloc(sizeof(*w))) == NULL)
+        return NULL;
+    if ((w->wake = PyThread_allocate_lock()) == NULL) {
+        free(w);
+        return NULL;
+    }
+    PyThread_acquire_lock(w->wake, 1);
+    if (!start_thread(pool_thread, w)) {
+        PyThread_free_lock(w->wake);
+        free(w);
+        return NULL;
+    }
+    pool_size++;
+    return w;
+}
+
+#ifndef _WIN32
+static void
+pool_after_fork(void)
+{
+    pool_mutex = PyThread_allocate_lock();
+    pool_idle = NULL;
+    pool_size = 0;
+}
+#endif
+
+int
+pyblake2_threads_init(void)
+{
+    if (pool_mutex != NULL)
+        return 1;
+    if ((pool_mutex = PyThread_allocate_lock()) == NULL)
+        return 0;
+#ifndef _WIN32
+    pthread_atfork(NULL, NULL, pool_after_fork);
+#endif
+    return 1;
+}
+
+void
+pyblake2_parallel_for(size_t n, unsigned int nthreads,
+                      void (*fn)(void *arg, size_t start, size_t end),
+                      void *arg)
+{
+    parallel_job job;
+    pool_worker *w;
+    unsigned int i;
+
+    if (nthreads > n)
+        nthreads = (unsigned int)n;
+    if (nthreads <= 1 || pool_mutex == NULL)
+        goto sequential;
+
+    job.mutex = PyThread_allocate_lock();
+    job.done = PyThread_allocate_lock();
+    if (job.mutex == NULL || job.done == NULL) {
+        if (job.mutex != NULL)
+            PyThread_free_lock(job.mutex);
+        if (job.done != NULL)
+            PyThread_free_lock(job.done);
+        goto sequential;
+    }
+
+    job.fn = fn;
+    job.arg = arg;
+    job.n = n;
+    job.next = 0;
+    job.grain = n / ((size_t)nthreads * RANGES_PER_THREAD);
+    if (job.grain == 0)
+        job.grain = 1;
+    /* The calling thread counts as running until it joins the work, so
+     * done can't be released while workers are being handed the job. */
+    job.running = 1;
+    PyThread_acquire_lock(job.done, 1);
+
+    PyThread_acquire_lock(pool_mutex, 1);
+    for (i = 1; i < nthreads; i++) {
+        if ((w = pool_get_worker()) == NULL)
+            break;
+        PyThread_acquire_lock(job.mutex, 1);
+        job.running++;
+        PyThread_release_lock(job.mutex);
+
+        w->fn = parallel_worker;
+        w->arg = &job;
+        PyThread_release_lock(w->wake);
+    }
+    PyThread_release_lock(pool_mutex);
+
+    parallel_worker(&job);
+
+    /* Wait for the workers. */
+    PyThread_acquire_lock(job.done, 1);
+    PyThread_release_lock(job.done);
+
+    PyThread_free_lock(job.mutex);
+    PyThread_free_lock(job.done);
+    return;
+
+sequential:
+    if (n > 0)
+        fn(arg, 0, n);
+}
+
+int
+pyblake2_run_thread(void (*fn)(void *arg), void *arg)
+{
+    pool_worker *w = NULL;
+
+    if (pool_mutex != NULL) {
+        PyThread_acquire_lock(pool_mutex, 1);
+        w = pool_get_worker();
+        PyThread_release_lock(pool_mutex);
+    }
+    if (w == NULL)
+        return start_thread(fn, arg);
+
+    w->fn = fn;
+    w->arg = arg;
+    PyThread_release_lock(w->wake);
+    return 1;
+}
+
+#else /* !WITH_THREAD */
+
+int
+pyblake2_threads_init(void)
+{
+    return 1;
+}
+
+void
+pyblake2_parallel_for(size_t n, unsigned int nthreads,
+                      void (*fn)(void *arg, size_t start, size_t end),
+                      void *arg)
+{
+    if (n > 0)
+        fn(arg, 0, n);
+}
+
+int
+pyblake2_run_thread(void (*fn)(void *arg), void *arg)
+{
+    return 0;
+}
+
+#endif /* !WITH_THREAD */
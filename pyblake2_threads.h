@@ -0,0 +1,37 @@
+#ifndef PYBLAKE2_THREADS_H
+#define PYBLAKE2_THREADS_H
+
+#include <stddef.h>
+
+/* Returns the number of online CPUs, or 1 if it can't be determined. */
+unsigned int pyblake2_cpu_count(void);
+
+/*
+ * Prepare the worker pool used by pyblake2_parallel_for() and
+ * pyblake2_run_thread(); called with the GIL held at module import.
+ * Returns 0 if out of memory, in which case work is done by the calling
+ * thread.
+ */
+int pyblake2_threads_init(void);
+
+/*
+ * Call fn(arg, start, end) for consecutive ranges covering [0, n) from up
+ * to nthreads native threads, one of which is the calling thread, and
+ * return when all of them are done. The other threads are taken from a
+ * pool, which starts them when first needed and keeps them for later
+ * calls. fn must not use Python API, so the caller should release the
+ * GIL. Without thread support, or if threads can't be started, the work
+ * is done by fewer threads.
+ */
+void pyblake2_parallel_for(size_t n, unsigned int nthreads,
+                           void (*fn)(void *arg, size_t start, size_t end),
+                           void *arg);
+
+/*
+ * Run fn(arg), which must not use Python API, on a native thread from the
+ * pool, or on a new thread if the pool is full. Returns 0 if the thread
+ * can't be started, or without thread support.
+ */
+int pyblake2_run_thread(void (*fn)(void *arg), void *arg);
+
+#endif /* PYBLAKE2_THREADS_H */
@@ -10,6 +10,9 @@
 #include <Python.h>
 
 #include "pyblake2_impl_common.h"
+#include "pyblake2_dispatch.h"
+#include "pyblake2_threads.h"
+#include "pyblake2_file.h"
 #include "impl/blake2.h"
 #include "impl/blake2-impl.h" /* for secure_zero_memory() and store48() */
 
@@ -41,14 +44,47 @@ PyDoc_STRVAR(pyblake2__doc__,
 # define COMPAT_PYSTRING_FROM_STRING             PyUnicode_FromString
 # define COMPAT_PYSTRING_FROM_STRING_AND_SIZE    PyUnicode_FromStringAndSize
 # define COMPAT_PYBYTES_FROM_STRING_AND_SIZE     PyBytes_FromStringAndSize
+# define COMPAT_PYBYTES_AS_STRING                PyBytes_AS_STRING
 # define BYTES_FMT                              "y"
+# define COMPAT_PYEXC_IO_ERROR                   PyExc_OSError
 #else
 # define COMPAT_PYINT_AS_LONG                    PyInt_AsLong
 # define COMPAT_PYINT_FROM_LONG                  PyInt_FromLong
 # define COMPAT_PYSTRING_FROM_STRING             PyString_FromString
 # define COMPAT_PYSTRING_FROM_STRING_AND_SIZE    PyString_FromStringAndSize
 # define COMPAT_PYBYTES_FROM_STRING_AND_SIZE     PyString_FromStringAndSize
+# define COMPAT_PYBYTES_AS_STRING                PyString_AS_STRING
 # define BYTES_FMT                              "s"
+# define COMPAT_PYEXC_IO_ERROR                   PyExc_IOError
+#endif
+
+/*
+ * Py_TYPE() isn't an lvalue since Python 3.11; Py_SET_TYPE() is
+ * available since 3.9.
+ */
+#ifndef Py_SET_TYPE
+# define Py_SET_TYPE(obj, type) (Py_TYPE(obj) = (type))
+#endif
+
+/*
+ * Fast calling convention, which passes arguments in a C array instead
+ * of a tuple and a dictionary, is public since Python 3.7.
+ */
+#if PY_VERSION_HEX >= 0x03070000
+# define HAVE_FASTCALL
+#endif
+
+/*
+ * Function and calling convention of a method table entry for func, which
+ * takes arguments as a tuple and a dictionary, or for func_fast if the
+ * fast calling convention is available.
+ */
+#ifdef HAVE_FASTCALL
+# define FASTCALL_METHOD(func) \
+    (PyCFunction)func##_fast, METH_FASTCALL|METH_KEYWORDS
+#else
+# define FASTCALL_METHOD(func) \
+    (PyCFunction)func, METH_VARARGS|METH_KEYWORDS
 #endif
 
 /*
@@ -57,6 +93,45 @@ PyDoc_STRVAR(pyblake2__doc__,
  */
 #define GIL_MINSIZE 2048
 
+/*
+ * Minimum size of buffer when updating parallel
+ * hash objects for leaves to be hashed on worker
+ * threads (if there's a CPU for each leaf). The
+ * default can be changed by set_threads_minsize().
+ */
+#ifndef THREADS_MINSIZE
+# define THREADS_MINSIZE (1 << 20)
+#endif
+
+/*
+ * Minimum number of CPUs for leaves to be hashed
+ * on worker threads; 0 means one for each leaf.
+ * The default can be changed like THREADS_MINSIZE.
+ */
+#ifndef THREADS_MINCPUS
+# define THREADS_MINCPUS 0
+#endif
+
+/*
+ * Maximum number of freed hash objects of each
+ * type kept for reuse.
+ */
+#ifndef FREE_LIST_MAXSIZE
+# define FREE_LIST_MAXSIZE 80
+#endif
+
+/*
+ * Default size of each of the buffers used
+ * by update_from_fd().
+ */
+#define STREAM_BUFSIZE (1 << 20)
+
+/*
+ * Version of the format of serialized hash
+ * states, changed if it ever has to be.
+ */
+#define STATE_FORMAT_VERSION 1
+
 #ifdef WITH_THREAD
 # include "pythread.h"
 
@@ -80,6 +155,11 @@ PyDoc_STRVAR(pyblake2__doc__,
     (obj)->lock = NULL;         \
 } while (0)
 
+# define ENSURE_LOCK(obj)                                   \
+    if ((obj)->lock == NULL) {                              \
+        (obj)->lock = PyThread_allocate_lock();             \
+    }
+
 # define FREE_LOCK(obj)                     \
     if ((obj)->lock) {                      \
         PyThread_free_lock((obj)->lock);    \
@@ -91,6 +171,7 @@ PyDoc_STRVAR(pyblake2__doc__,
 # define ACQUIRE_LOCK(obj)
 # define RELEASE_LOCK(obj)
 # define INIT_LOCK(obj)
+# define ENSURE_LOCK(obj)
 # define FREE_LOCK(obj)
 #endif /* !WITH_THREAD */
 
@@ -118,18 +199,467 @@ getbuffer(PyObject *obj, Py_buffer *bp) {
     return 1;
 }
 
+/*
+ * Hex encoding of digests. With SSE2, which all x86-64 CPUs have, nibbles
+ * of 16 bytes are split, interleaved, and turned into digits at once.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define HAVE_SSE2_TOHEX
+#endif
+
 static void
-tohex(char *dst, uint8_t *src, size_t srclen)
+tohex(char *dst, const uint8_t *src, size_t srclen)
 {
     static char hexdigits[] = "0123456789abcdef";
-    size_t i;
+    size_t i = 0;
+#ifdef HAVE_SSE2_TOHEX
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i digit = _mm_set1_epi8('0');
+    const __m128i letter = _mm_set1_epi8('a' - '0' - 10);
+    __m128i in, hi, lo, a, b;
+
+    for (; i + 16 <= srclen; i += 16) {
+        in = _mm_loadu_si128((const __m128i *)(src + i));
+        hi = _mm_and_si128(_mm_srli_epi16(in, 4), mask);
+        lo = _mm_and_si128(in, mask);
+        a = _mm_unpacklo_epi8(hi, lo);
+        b = _mm_unpackhi_epi8(hi, lo);
+        a = _mm_add_epi8(_mm_add_epi8(a, digit),
+                         _mm_and_si128(_mm_cmpgt_epi8(a, nine), letter));
+        b = _mm_add_epi8(_mm_add_epi8(b, digit),
+                         _mm_and_si128(_mm_cmpgt_epi8(b, nine), letter));
+        _mm_storeu_si128((__m128i *)(dst + i*2), a);
+        _mm_storeu_si128((__m128i *)(dst + i*2 + 16), b);
+    }
+#endif
 
-    for (i = 0; i < srclen; i++) {
+    for (; i < srclen; i++) {
         dst[i*2 + 0] = hexdigits[(src[i] >> 4) & 0x0f];
         dst[i*2 + 1] = hexdigits[src[i] & 0x0f];
     }
 }
 
+/* Return hex digits of src as str, written directly into a new object. */
+static PyObject *
+hex_string(const uint8_t *src, size_t srclen)
+{
+    PyObject *str;
+
+#if PY_MAJOR_VERSION >= 3
+    if ((str = PyUnicode_New(srclen * 2, 127)) == NULL)
+        return NULL;
+    tohex((char *)PyUnicode_1BYTE_DATA(str), src, srclen);
+#else
+    if ((str = PyString_FromStringAndSize(NULL, srclen * 2)) == NULL)
+        return NULL;
+    tohex(PyString_AS_STRING(str), src, srclen);
+#endif
+    return str;
+}
+
+/* Return hex digits of src as ASCII bytes. */
+static PyObject *
+hex_bytes(const uint8_t *src, size_t srclen)
+{
+    PyObject *bytes;
+
+    bytes = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(NULL, srclen * 2);
+    if (bytes == NULL)
+        return NULL;
+    tohex(COMPAT_PYBYTES_AS_STRING(bytes), src, srclen);
+    return bytes;
+}
+
+/*
+ * Keys of hash objects, kept to reset them. A key is shared by copies of
+ * the object it was given to and zeroed when the last of them is freed;
+ * the reference count is protected by the GIL.
+ */
+
+typedef struct {
+    Py_ssize_t refcnt;
+    size_t len;
+    uint8_t data[1];
+} blake2_key;
+
+/* Storage for a key of up to len bytes, such as on the stack. */
+#define KEY_STORAGE(len) \
+    union { blake2_key key; uint8_t bytes[sizeof(blake2_key) + (len)]; }
+
+/* Initialize a key in storage with room for len bytes. */
+static blake2_key *
+init_key(blake2_key *key, const void *data, size_t len)
+{
+    key->refcnt = 1;
+    key->len = len;
+    memcpy(key->data, data, len);
+    return key;
+}
+
+static blake2_key *
+new_key(const void *data, size_t len)
+{
+    blake2_key *key;
+
+    key = (blake2_key *)PyMem_Malloc(sizeof(blake2_key) + len);
+    if (key == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    return init_key(key, data, len);
+}
+
+static blake2_key *
+key_incref(blake2_key *key)
+{
+    if (key != NULL)
+        key->refcnt++;
+    return key;
+}
+
+static void
+key_decref(blake2_key *key)
+{
+    if (key != NULL && --key->refcnt == 0) {
+        secure_zero_memory(key->data, key->len);
+        PyMem_Free(key);
+    }
+}
+
+static PyObject *
+finalized_error(void)
+{
+    PyErr_SetString(PyExc_ValueError, "hash object is finalized");
+    return NULL;
+}
+
+static PyObject *
+final_error(void)
+{
+    PyErr_SetString(PyExc_RuntimeError, "error finalizing hash state");
+    return NULL;
+}
+
+/*
+ * Raise the I/O error err of reading after nread bytes were hashed, which
+ * the hash object keeps, with nread as an attribute of the exception.
+ */
+static PyObject *
+read_error(int err, uint64_t nread)
+{
+    PyObject *type, *value, *tb, *count;
+
+    errno = err;
+    PyErr_SetFromErrno(COMPAT_PYEXC_IO_ERROR);
+    PyErr_Fetch(&type, &value, &tb);
+    PyErr_NormalizeException(&type, &value, &tb);
+    count = PyLong_FromUnsignedLongLong(nread);
+    if (count == NULL || PyObject_SetAttrString(value, "nread", count) < 0) {
+        Py_XDECREF(count);
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(tb);
+        return NULL;
+    }
+    Py_DECREF(count);
+    PyErr_Restore(type, value, tb);
+    return NULL;
+}
+
+/*
+ * Serialized hash states consist of the format version, the length and
+ * name of the hash function, its parameter block (little-endian by
+ * specification), the hash state, and the key length and key. Words of
+ * the state are stored in little-endian order too, so that states can be
+ * restored on machines of either byte order. The key is only included on
+ * request; its length is 0 otherwise.
+ */
+
+#define STATE_HEADER_SIZE(strname) (2 + sizeof(strname) - 1)
+
+static uint8_t *
+pack_state_header(uint8_t *p, const char *name)
+{
+    size_t len = strlen(name);
+
+    *p++ = STATE_FORMAT_VERSION;
+    *p++ = (uint8_t)len;
+    memcpy(p, name, len);
+    return p + len;
+}
+
+/* Returns a pointer past the header, or NULL with an exception set. */
+static const uint8_t *
+unpack_state_header(const uint8_t *p, size_t len, const char *name)
+{
+    size_t namelen = strlen(name);
+
+    if (len > 0 && p[0] != STATE_FORMAT_VERSION) {
+        PyErr_Format(PyExc_ValueError,
+                     "unsupported state format version %d", (int)p[0]);
+        return NULL;
+    }
+    if (len < 2 + namelen || p[1] != namelen ||
+            memcmp(p + 2, name, namelen) != 0) {
+        PyErr_Format(PyExc_ValueError, "not a %s state", name);
+        return NULL;
+    }
+    return p + 2 + namelen;
+}
+
+/* Store count words of width bytes (4 or 8) in little-endian order. */
+static uint8_t *
+pack_words(uint8_t *p, const void *words, size_t count, size_t width)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, p += width) {
+        if (width == 8)
+            store64(p, ((const uint64_t *)words)[i]);
+        else
+            store32(p, ((const uint32_t *)words)[i]);
+    }
+    return p;
+}
+
+static const uint8_t *
+unpack_words(const uint8_t *p, void *words, size_t count, size_t width)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++, p += width) {
+        if (width == 8)
+            ((uint64_t *)words)[i] = load64(p);
+        else
+            ((uint32_t *)words)[i] = load32(p);
+    }
+    return p;
+}
+
+/* Return nonzero if any of len bytes at p isn't zero. */
+static int
+any_nonzero(const uint8_t *p, size_t len)
+{
+    uint8_t acc = 0;
+
+    while (len-- > 0)
+        acc |= *p++;
+    return acc != 0;
+}
+
+/* Hash objects are pickled as a call of the module function func with
+ * their serialized state; steals the reference to state. */
+static PyObject *
+reduce_state(PyObject *state, const char *func)
+{
+    PyObject *module, *fn, *result = NULL;
+
+    if (state == NULL)
+        return NULL;
+    if ((module = PyImport_ImportModule("pyblake2")) != NULL) {
+        if ((fn = PyObject_GetAttrString(module, func)) != NULL) {
+            result = Py_BuildValue("O(O)", fn, state);
+            Py_DECREF(fn);
+        }
+        Py_DECREF(module);
+    }
+    Py_DECREF(state);
+    return result;
+}
+
+#ifdef HAVE_FASTCALL
+typedef PyObject *(*varargs_func)(PyObject *, PyObject *, PyObject *);
+
+/*
+ * Call a function taking arguments as a tuple and a dictionary with
+ * arguments passed by the fast calling convention.
+ */
+static PyObject *
+call_with_args(PyObject *self, PyObject *const *args, Py_ssize_t nargs,
+               PyObject *kwnames, varargs_func func)
+{
+    PyObject *tuple, *kw = NULL, *result = NULL;
+    Py_ssize_t i, nkw;
+
+    if ((tuple = PyTuple_New(nargs)) == NULL)
+        return NULL;
+    for (i = 0; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(tuple, i, args[i]);
+    }
+
+    nkw = kwnames != NULL ? PyTuple_GET_SIZE(kwnames) : 0;
+    if (nkw > 0) {
+        if ((kw = PyDict_New()) == NULL)
+            goto done;
+        for (i = 0; i < nkw; i++) {
+            if (PyDict_SetItem(kw, PyTuple_GET_ITEM(kwnames, i),
+                               args[nargs + i]) < 0)
+                goto done;
+        }
+    }
+
+    result = func(self, tuple, kw);
+
+done:
+    Py_DECREF(tuple);
+    Py_XDECREF(kw);
+    return result;
+}
+
+/*
+ * Get data and digest_size of a constructor call, leaving them untouched
+ * if not given. Returns 0 if there are other arguments, or digest_size
+ * is not an int, for the call to be handled by the full argument parser.
+ */
+static int
+get_fast_args(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+              PyObject **data, int *digest_size)
+{
+    PyObject *digest_size_obj = NULL, *name;
+    Py_ssize_t i, nkw;
+    long value;
+    int overflow;
+
+    if (nargs > 2)
+        return 0;
+    if (nargs > 0)
+        *data = args[0];
+    if (nargs > 1)
+        digest_size_obj = args[1];
+
+    nkw = kwnames != NULL ? PyTuple_GET_SIZE(kwnames) : 0;
+    for (i = 0; i < nkw; i++) {
+        name = PyTuple_GET_ITEM(kwnames, i);
+        if (*data == NULL &&
+                PyUnicode_CompareWithASCIIString(name, "data") == 0)
+            *data = args[nargs + i];
+        else if (digest_size_obj == NULL &&
+                PyUnicode_CompareWithASCIIString(name, "digest_size") == 0)
+            digest_size_obj = args[nargs + i];
+        else
+            return 0;
+    }
+
+    if (digest_size_obj != NULL) {
+        if (!PyLong_CheckExact(digest_size_obj))
+            return 0;
+        value = PyLong_AsLongAndOverflow(digest_size_obj, &overflow);
+        if (overflow || value < INT_MIN || value > INT_MAX)
+            return 0;
+        *digest_size = (int)value;
+    }
+    return 1;
+}
+
+/*
+ * Match arguments passed by the fast calling convention to the names in
+ * kwlist, storing them in argv (NULL if not given). Returns 0 if there are
+ * too many arguments, or unknown or repeated keywords, for the call to be
+ * handled by the full argument parser.
+ */
+static int
+get_fast_kwargs(PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                char **kwlist, PyObject **argv)
+{
+    PyObject *name;
+    Py_ssize_t i, j, n, nkw;
+
+    for (n = 0; kwlist[n] != NULL; n++)
+        argv[n] = NULL;
+    if (nargs > n)
+        return 0;
+    for (i = 0; i < nargs; i++)
+        argv[i] = args[i];
+
+    nkw = kwnames != NULL ? PyTuple_GET_SIZE(kwnames) : 0;
+    for (i = 0; i < nkw; i++) {
+        name = PyTuple_GET_ITEM(kwnames, i);
+        for (j = 0; j < n; j++) {
+            if (PyUnicode_CompareWithASCIIString(name, kwlist[j]) == 0)
+                break;
+        }
+        if (j == n || argv[j] != NULL)
+            return 0;
+        argv[j] = args[nargs + i];
+    }
+    return 1;
+}
+#endif /* HAVE_FASTCALL */
+
+/* Return path encoded for the file system as a new bytes object. */
+static PyObject *
+encode_path(PyObject *path)
+{
+    PyObject *bytes;
+
+#if PY_MAJOR_VERSION >= 3
+    if (!PyUnicode_FSConverter(path, &bytes))
+        return NULL;
+#else
+    if (PyUnicode_Check(path)) {
+        bytes = PyUnicode_AsEncodedString(path, Py_FileSystemDefaultEncoding,
+                                          NULL);
+    } else if (PyString_Check(path)) {
+        Py_INCREF(path);
+        bytes = path;
+    } else {
+        PyErr_SetString(PyExc_TypeError, "path must be a string");
+        return NULL;
+    }
+#endif
+    return bytes;
+}
+
+/*
+ * Open a file given as a path, or take a file descriptor as is. Returns
+ * the descriptor and sets *owned if it has to be closed, or returns -1
+ * with an exception set.
+ */
+static int
+open_file_arg(PyObject *file, int *owned)
+{
+    PyObject *path;
+    long fd;
+    int err;
+
+    *owned = 0;
+#if PY_MAJOR_VERSION >= 3
+    if (PyLong_Check(file)) {
+#else
+    if (PyInt_Check(file) || PyLong_Check(file)) {
+#endif
+        fd = COMPAT_PYINT_AS_LONG(file);
+        if (fd == -1 && PyErr_Occurred())
+            return -1;
+        if (fd < 0 || fd > INT_MAX) {
+            PyErr_SetString(PyExc_ValueError, "invalid file descriptor");
+            return -1;
+        }
+        return (int)fd;
+    }
+
+    if ((path = encode_path(file)) == NULL)
+        return -1;
+
+    Py_BEGIN_ALLOW_THREADS
+    fd = pyblake2_open_file(PyBytes_AS_STRING(path));
+    err = errno;
+    Py_END_ALLOW_THREADS
+    Py_DECREF(path);
+
+    if (fd < 0) {
+        errno = err;
+        PyErr_SetFromErrnoWithFilenameObject(COMPAT_PYEXC_IO_ERROR, file);
+        return -1;
+    }
+    *owned = 1;
+    return (int)fd;
+}
+
 /*
  * Helpers for setting node offset.
  */
@@ -155,25 +685,417 @@ blake2s_set_node_offset(blake2s_param *param, uint64_t offset)
  * Unleash the macros!
  */
 
+/*
+ * Update used while the GIL is released. Parallel variants hash leaves of
+ * large updates on worker threads, one leaf per thread, when there's a CPU
+ * for each of them: otherwise interleaving leaves with SIMD on one core is
+ * faster.
+ */
+static uint64_t threads_minsize = THREADS_MINSIZE;
+static unsigned int threads_mincpus = THREADS_MINCPUS;
+
+#define DECL_BLAKE2_UPDATE_NOGIL(name)                                        \
+    static int                                                                \
+    name##_update_nogil(name##_state *S, const uint8_t *in, uint64_t inlen)   \
+    {                                                                         \
+        return name##_update(S, in, inlen);                                   \
+    }
+
+
+#define DECL_BLAKE2P_UPDATE_NOGIL(name, leafname, bigname, leaves)            \
+    typedef struct {                                                          \
+        name##_state *S;                                                      \
+        const uint8_t *in;                                                    \
+        size_t stripes;                                                       \
+    } name##_leaves_job;                                                      \
+                                                                              \
+    static void                                                               \
+    name##_hash_leaves(void *arg, size_t start, size_t end)                   \
+    {                                                                         \
+        const name##_leaves_job *job = (const name##_leaves_job *)arg;        \
+        const uint8_t *in;                                                    \
+        size_t i, k;                                                          \
+                                                                              \
+        /* Leaf i gets every leaves-th block starting with block i. */        \
+        for (i = start; i < end; i++) {                                       \
+            in = job->in + i * bigname##_BLOCKBYTES;                          \
+            for (k = 0; k < job->stripes; k++) {                              \
+                leafname##_update(job->S->S[i], in, bigname##_BLOCKBYTES);    \
+                in += leaves * bigname##_BLOCKBYTES;                          \
+            }                                                                 \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    static int                                                                \
+    name##_update_nogil(name##_state *S, const uint8_t *in, uint64_t inlen)   \
+    {                                                                         \
+        name##_leaves_job job;                                                \
+        size_t fill;                                                          \
+                                                                              \
+        if (inlen < threads_minsize ||                                        \
+                pyblake2_cpu_count() < (threads_mincpus ? threads_mincpus     \
+                                                        : leaves))            \
+            return name##_update(S, in, inlen);                               \
+                                                                              \
+        /* Complete and hash buffered stripe first. */                        \
+        if (S->buflen > 0) {                                                  \
+            fill = sizeof(S->buf) - S->buflen;                                \
+            name##_update(S, in, fill);                                       \
+            in += fill;                                                       \
+            inlen -= fill;                                                    \
+        }                                                                     \
+                                                                              \
+        job.S = S;                                                            \
+        job.in = in;                                                          \
+        job.stripes = (size_t)(inlen / sizeof(S->buf));                       \
+        pyblake2_parallel_for(leaves, leaves, name##_hash_leaves, &job);      \
+                                                                              \
+        /* Buffer the rest. */                                                \
+        in += job.stripes * sizeof(S->buf);                                   \
+        inlen -= job.stripes * sizeof(S->buf);                                \
+        return name##_update(S, in, inlen);                                   \
+    }
+
+
+/* Update used as a callback for data read from files. */
+#define DECL_BLAKE2_UPDATE_DATA(name)                                         \
+    static void                                                               \
+    name##_update_data(void *state, const uint8_t *data, size_t len)          \
+    {                                                                         \
+        name##_update_nogil((name##_state *)state, data, len);                \
+    }
+
+
 #define DECL_BLAKE2_STRUCT(name)        \
     static PyTypeObject name##Type;     \
                                         \
     typedef struct {                    \
         PyObject_HEAD                   \
         name##_param    param;          \
-        name##_state    state;          \
+        blake2_key      *key;           \
         OBJECT_LOCK_FIELD               \
+        uint8_t         finalized;      \
+        name##_state    state;          \
     } name##Object;
 
 
+/*
+ * Initialize hash state from parameters and key of the object. The last
+ * node flag, which isn't a part of the parameter block, is kept.
+ */
+#define DECL_BLAKE2_RESET_STATE(name, bigname)                          \
+    static int                                                          \
+    name##_reset_state(name##Object *self)                              \
+    {                                                                   \
+        uint8_t block[bigname##_BLOCKBYTES];                            \
+        uint8_t last_node = self->state.last_node;                      \
+                                                                        \
+        if (name##_init_param(&self->state, &self->param) < 0)          \
+            return 0;                                                   \
+        self->state.last_node = last_node;                              \
+                                                                        \
+        if (self->key != NULL) {                                        \
+            memset(block, 0, sizeof(block));                            \
+            memcpy(block, self->key->data, self->key->len);             \
+            name##_update(&self->state, block, sizeof(block));          \
+            secure_zero_memory(block, sizeof(block));                   \
+        }                                                               \
+        return 1;                                                       \
+    }
+
+
+/* Tree parameters are set by the variant, and the key block is processed
+ * by each leaf. */
+#define DECL_BLAKE2P_RESET_STATE(name)                                  \
+    static int                                                          \
+    name##_reset_state(name##Object *self)                              \
+    {                                                                   \
+        return name##_init_param(&self->state, &self->param,            \
+                self->key != NULL ? self->key->data : NULL) == 0;       \
+    }
+
+
+/*
+ * Serialization of hash states: h, t, f, buflen, last_node and buf. The
+ * size of states with words of the digest size / 8 bytes is given by
+ * STATE_SIZE. Bytes of buf past buflen are stored as zeros, since they
+ * may be left from the key block. Unpacking returns NULL if buflen or
+ * last_node is invalid, if the finalization flags f are set, or if bytes
+ * of buf past buflen aren't zero. The key block itself stays in buf until data is
+ * added, which key_buffered() tells for states of keyed hashes.
+ */
+#define STATE_SIZE(bigname) \
+    (12 * (bigname##_OUTBYTES / 8) + 2 + bigname##_BLOCKBYTES)
+
+#define DECL_BLAKE2_STATE_CODEC(name, bigname)                          \
+    static const size_t name##_state_size = STATE_SIZE(bigname);        \
+                                                                        \
+    static uint8_t *                                                    \
+    name##_pack_state(uint8_t *p, const name##_state *S)                \
+    {                                                                   \
+        p = pack_words(p, S->h, 8, sizeof(S->h[0]));                    \
+        p = pack_words(p, S->t, 2, sizeof(S->t[0]));                    \
+        p = pack_words(p, S->f, 2, sizeof(S->f[0]));                    \
+        *p++ = (uint8_t)S->buflen;                                      \
+        *p++ = S->last_node;                                            \
+        memcpy(p, S->buf, S->buflen);                                   \
+        memset(p + S->buflen, 0, sizeof(S->buf) - S->buflen);           \
+        return p + sizeof(S->buf);                                      \
+    }                                                                   \
+                                                                        \
+    static const uint8_t *                                              \
+    name##_unpack_state(const uint8_t *p, name##_state *S)              \
+    {                                                                   \
+        p = unpack_words(p, S->h, 8, sizeof(S->h[0]));                  \
+        p = unpack_words(p, S->t, 2, sizeof(S->t[0]));                  \
+        p = unpack_words(p, S->f, 2, sizeof(S->f[0]));                  \
+        if (S->f[0] != 0 || S->f[1] != 0 ||                             \
+                p[0] > sizeof(S->buf) || p[1] > 1 ||                    \
+                any_nonzero(p + 2 + p[0], sizeof(S->buf) - p[0]))       \
+            return NULL;                                                \
+        S->buflen = *p++;                                               \
+        S->last_node = *p++;                                            \
+        memcpy(S->buf, p, sizeof(S->buf));                              \
+        return p + sizeof(S->buf);                                      \
+    }                                                                   \
+                                                                        \
+    static int                                                          \
+    name##_key_buffered(const name##_state *S)                          \
+    {                                                                   \
+        return S->t[0] == 0 && S->t[1] == 0 &&                          \
+            S->buflen == bigname##_BLOCKBYTES;                          \
+    }
+
+
+/* Leaf states, the root state, and the buffer with a 16-bit length. */
+#define DECL_BLAKE2P_STATE_CODEC(name, leafname, bigname, leaves)       \
+    static const size_t name##_state_size =                             \
+        (leaves + 1) * STATE_SIZE(bigname) +                            \
+        leaves * bigname##_BLOCKBYTES + 2;                              \
+                                                                        \
+    static uint8_t *                                                    \
+    name##_pack_state(uint8_t *p, const name##_state *S)                \
+    {                                                                   \
+        size_t i;                                                       \
+                                                                        \
+        for (i = 0; i < leaves; i++)                                    \
+            p = leafname##_pack_state(p, S->S[i]);                      \
+        p = leafname##_pack_state(p, S->R);                             \
+        *p++ = (uint8_t)S->buflen;                                      \
+        *p++ = (uint8_t)(S->buflen >> 8);                               \
+        memcpy(p, S->buf, S->buflen);                                   \
+        memset(p + S->buflen, 0, sizeof(S->buf) - S->buflen);           \
+        return p + sizeof(S->buf);                                      \
+    }                                                                   \
+                                                                        \
+    static const uint8_t *                                              \
+    name##_unpack_state(const uint8_t *p, name##_state *S)              \
+    {                                                                   \
+        size_t i, buflen;                                               \
+                                                                        \
+        for (i = 0; i < leaves && p != NULL; i++)                       \
+            p = leafname##_unpack_state(p, S->S[i]);                    \
+        if (p != NULL)                                                  \
+            p = leafname##_unpack_state(p, S->R);                       \
+        if (p == NULL)                                                  \
+            return NULL;                                                \
+        buflen = p[0] | (size_t)p[1] << 8;                              \
+        if (buflen > sizeof(S->buf) ||                                  \
+                any_nonzero(p + 2 + buflen, sizeof(S->buf) - buflen))   \
+            return NULL;                                                \
+        S->buflen = buflen;                                             \
+        memcpy(S->buf, p + 2, sizeof(S->buf));                          \
+        return p + 2 + sizeof(S->buf);                                  \
+    }                                                                   \
+                                                                        \
+    static int                                                          \
+    name##_key_buffered(const name##_state *S)                          \
+    {                                                                   \
+        size_t i;                                                       \
+                                                                        \
+        for (i = 0; i < leaves; i++) {                                  \
+            if (leafname##_key_buffered(S->S[i]))                       \
+                return 1;                                               \
+        }                                                               \
+        return 0;                                                       \
+    }
+
+
+/*
+ * Parameters set by constructors called with data and digest_size only,
+ * in addition to a zeroed parameter block.
+ */
+#define DECL_BLAKE2_SET_DEFAULTS(name)                                  \
+    static inline void                                                  \
+    name##_set_defaults(name##Object *self)                             \
+    {                                                                   \
+        self->param.fanout = 1;                                         \
+        self->param.depth = 1;                                          \
+        self->state.last_node = 0;                                      \
+    }
+
+
+#define DECL_BLAKE2P_SET_DEFAULTS(name)                                 \
+    static inline void                                                  \
+    name##_set_defaults(name##Object *self)                             \
+    {                                                                   \
+        (void)self;                                                     \
+    }
+
+
+/*
+ * Freed objects are kept in a free list linked through their type field,
+ * like floats in CPython. The list is freed with the module and started
+ * anew when the module is imported again.
+ */
 #define DECL_NEW_BLAKE2_OBJECT(name)                                    \
+    static name##Object *name##_free_list = NULL;                       \
+    static int name##_free_count = 0;                                   \
+                                                                        \
     static name##Object *                                               \
     new_##name##Object(void)                                            \
     {                                                                   \
         name##Object *obj;                                              \
-        obj = (name##Object *)PyObject_New(name##Object, &name##Type);  \
-        if (obj != NULL) INIT_LOCK(obj);                                \
+                                                                        \
+        if (name##_free_list != NULL) {                                 \
+            obj = name##_free_list;                                     \
+            name##_free_list = (name##Object *)Py_TYPE(obj);            \
+            name##_free_count--;                                        \
+            PyObject_Init((PyObject *)obj, &name##Type);                \
+        } else {                                                        \
+            obj = PyObject_New(name##Object, &name##Type);              \
+            if (obj == NULL)                                            \
+                return NULL;                                            \
+        }                                                               \
+                                                                        \
+        obj->finalized = 0;                                             \
+        obj->key = NULL;                                                \
+        INIT_LOCK(obj);                                                 \
         return obj;                                                     \
+    }                                                                   \
+                                                                        \
+    static void                                                         \
+    name##_clear_free_list(void)                                        \
+    {                                                                   \
+        name##Object *obj;                                              \
+                                                                        \
+        while (name##_free_list != NULL) {                              \
+            obj = name##_free_list;                                     \
+            name##_free_list = (name##Object *)Py_TYPE(obj);            \
+            PyObject_Del(obj);                                          \
+        }                                                               \
+        name##_free_count = 0;                                          \
+    }
+
+
+/* Release parameter buffers filled by the argument parser. */
+static void
+release_param_buffers(Py_buffer *key, Py_buffer *salt, Py_buffer *person)
+{
+    if (key->buf != NULL)
+        PyBuffer_Release(key);
+    if (salt->buf != NULL)
+        PyBuffer_Release(salt);
+    if (person->buf != NULL)
+        PyBuffer_Release(person);
+}
+
+
+/*
+ * Initialization steps shared by all variants: setting the digest size,
+ * salt, personalization and key length in a zeroed parameter block, then
+ * keeping the key, initializing the state and processing initial data.
+ * Variants set their tree parameters in between.
+ */
+#define DECL_INIT_BLAKE2_COMMON(name, bigname)                                \
+    static int                                                                \
+    name##_set_common_params(name##Object *self, int digest_size,             \
+                             const Py_buffer *key, const Py_buffer *salt,     \
+                             const Py_buffer *person)                         \
+    {                                                                         \
+        /* Zero parameter block. */                                           \
+        memset(&self->param, 0, sizeof(self->param));                         \
+                                                                              \
+        /* Set digest size. */                                                \
+        if (digest_size <= 0 || digest_size > bigname##_OUTBYTES) {           \
+            PyErr_Format(PyExc_ValueError,                                    \
+                    "digest_size must be between 1 and %d bytes",             \
+                    bigname##_OUTBYTES);                                      \
+            return 0;                                                         \
+        }                                                                     \
+        self->param.digest_length = digest_size;                              \
+                                                                              \
+        /* Set salt parameter. */                                             \
+        if (salt->buf != NULL) {                                              \
+            if (salt->len > bigname##_SALTBYTES) {                            \
+                PyErr_Format(PyExc_ValueError,                                \
+                    "maximum salt length is %d bytes",                        \
+                    bigname##_SALTBYTES);                                     \
+                return 0;                                                     \
+            }                                                                 \
+            memcpy(self->param.salt, salt->buf, salt->len);                   \
+        }                                                                     \
+                                                                              \
+        /* Set personalization parameter. */                                  \
+        if (person->buf != NULL) {                                            \
+            if (person->len > bigname##_PERSONALBYTES) {                      \
+                PyErr_Format(PyExc_ValueError,                                \
+                    "maximum person length is %d bytes",                      \
+                    bigname##_PERSONALBYTES);                                 \
+                return 0;                                                     \
+            }                                                                 \
+            memcpy(self->param.personal, person->buf, person->len);           \
+        }                                                                     \
+                                                                              \
+        /* Set key length. */                                                 \
+        if (key->buf != NULL && key->len > 0) {                               \
+            if (key->len > bigname##_KEYBYTES) {                              \
+                PyErr_Format(PyExc_ValueError,                                \
+                    "maximum key length is %d bytes",                         \
+                    bigname##_KEYBYTES);                                      \
+                return 0;                                                     \
+            }                                                                 \
+            self->param.key_length = key->len;                                \
+        }                                                                     \
+        return 1;                                                             \
+    }                                                                         \
+                                                                              \
+    static int                                                                \
+    name##_init_state(name##Object *self, const Py_buffer *key,               \
+                      PyObject *data, blake2_key *keybuf)                     \
+    {                                                                         \
+        Py_buffer buf;                                                        \
+                                                                              \
+        /* Keep key to reset the object, in keybuf if given. */               \
+        if (key->buf != NULL && key->len > 0) {                               \
+            if (keybuf != NULL)                                               \
+                self->key = init_key(keybuf, key->buf, key->len);             \
+            else if ((self->key = new_key(key->buf, key->len)) == NULL)       \
+                return 0;                                                     \
+        }                                                                     \
+                                                                              \
+        /* Initialize hash state and process key block if any. */             \
+        if (!name##_reset_state(self)) {                                      \
+            PyErr_SetString(PyExc_RuntimeError,                               \
+                    "error initializing hash state");                         \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        /* Process initial data if any. */                                    \
+        if (data != NULL) {                                                   \
+            if (!getbuffer(data, &buf))                                       \
+                return 0;                                                     \
+                                                                              \
+            if (buf.len >= GIL_MINSIZE) {                                     \
+                Py_BEGIN_ALLOW_THREADS                                        \
+                name##_update_nogil(&self->state, buf.buf, buf.len);          \
+                Py_END_ALLOW_THREADS                                          \
+            } else {                                                          \
+                name##_update(&self->state, buf.buf, buf.len);                \
+            }                                                                 \
+            PyBuffer_Release(&buf);                                           \
+        }                                                                     \
+        return 1;                                                             \
     }
 
 
@@ -185,18 +1107,21 @@ static char *kwlist[] = {
 
 #define DECL_INIT_BLAKE2_OBJECT(name, bigname)                                \
     static int                                                                \
-    init_##name##Object(name##Object *self, PyObject *args, PyObject *kw)     \
+    init_##name##Object(name##Object *self, PyObject *args, PyObject *kw,     \
+                        blake2_key *keybuf)                                   \
     {                                                                         \
-        Py_buffer buf, key, salt, person;                                     \
+        Py_buffer key, salt, person;                                          \
         PyObject *data = NULL, *last_node_obj = NULL, *fanout_obj = NULL,     \
                  *depth_obj = NULL;                                           \
         unsigned int leaf_size = 0;                                           \
         unsigned PY_LONG_LONG node_offset = 0;                                \
         int node_depth = 0, inner_size = 0, digest_size = bigname##_OUTBYTES; \
         long fanout = 1, depth = 1;                                           \
+        int ok = 0;                                                           \
                                                                               \
         /* Initialize buffers. */                                             \
         key.buf = salt.buf = person.buf = NULL;                               \
+        self->key = NULL;                                                     \
                                                                               \
         /* Parse arguments. */                                                \
         if (!PyArg_ParseTupleAndKeywords(args, kw,                            \
@@ -217,64 +1142,34 @@ static char *kwlist[] = {
                     kwlist, &data, &digest_size, &key, &salt, &person,        \
                     &fanout_obj, &depth_obj, &leaf_size, &node_offset,        \
                     &node_depth, &inner_size, &last_node_obj))                \
-            goto err0;                                                        \
-                                                                              \
-        /* Zero parameter block. */                                           \
-        memset(&self->param, 0, sizeof(self->param));                         \
-                                                                              \
-        /* Set digest size. */                                                \
-        if (digest_size <= 0 || digest_size > bigname##_OUTBYTES) {           \
-            PyErr_Format(PyExc_ValueError,                                    \
-                    "digest_size must be between 1 and %d bytes",             \
-                    bigname##_OUTBYTES);                                      \
-            goto err0;                                                        \
-        }                                                                     \
-        self->param.digest_length = digest_size;                              \
+            goto done;                                                        \
                                                                               \
-        /* Set salt parameter. */                                             \
-        if (salt.buf != NULL) {                                               \
-            if (salt.len > bigname##_SALTBYTES) {                             \
-                PyErr_Format(PyExc_ValueError,                                \
-                    "maximum salt length is %d bytes",                        \
-                    bigname##_SALTBYTES);                                     \
-                goto err0;                                                    \
-            }                                                                 \
-            memcpy(self->param.salt, salt.buf, salt.len);                     \
-        }                                                                     \
-                                                                              \
-        /* Set personalization parameter. */                                  \
-        if (person.buf != NULL) {                                             \
-            if (person.len > bigname##_PERSONALBYTES) {                       \
-                PyErr_Format(PyExc_ValueError,                                \
-                    "maximum person length is %d bytes",                      \
-                    bigname##_PERSONALBYTES);                                 \
-                goto err0;                                                    \
-            }                                                                 \
-            memcpy(self->param.personal, person.buf, person.len);             \
-        }                                                                     \
+        if (!name##_set_common_params(self, digest_size, &key, &salt,         \
+                                      &person))                               \
+            goto done;                                                        \
                                                                               \
         /* Set tree parameters. */                                            \
         if (fanout_obj != NULL) {                                             \
             fanout = COMPAT_PYINT_AS_LONG(fanout_obj);                        \
             if (fanout == -1 && PyErr_Occurred())                             \
-                goto err0;                                                    \
+                goto done;                                                    \
         }                                                                     \
         if (fanout < 0 || fanout > 255) {                                     \
             PyErr_SetString(PyExc_ValueError,                                 \
                     "fanout must be between 0 and 255");                      \
-            goto err0;                                                        \
+            goto done;                                                        \
         }                                                                     \
         self->param.fanout = (uint8_t)fanout;                                 \
                                                                               \
         if (depth_obj != NULL) {                                              \
             depth = COMPAT_PYINT_AS_LONG(depth_obj);                          \
             if (depth == -1 && PyErr_Occurred())                              \
-                goto err0;                                                    \
+                goto done;                                                    \
         }                                                                     \
         if (depth <= 0 || depth > 255) {                                      \
             PyErr_SetString(PyExc_ValueError,                                 \
                     "depth must be between 1 and 255");                       \
-            goto err0;                                                        \
+            goto done;                                                        \
         }                                                                     \
         self->param.depth = (uint8_t)depth;                                   \
                                                                               \
@@ -282,13 +1177,13 @@ static char *kwlist[] = {
                                                                               \
         if (!name##_set_node_offset(&self->param, node_offset)) {             \
             PyErr_SetString(PyExc_ValueError, "node_offset is too large");    \
-            goto err0;                                                        \
+            goto done;                                                        \
         }                                                                     \
                                                                               \
         if (node_depth < 0 || node_depth > 255) {                             \
             PyErr_SetString(PyExc_ValueError,                                 \
                     "node_depth must be between 0 and 255");                  \
-            goto err0;                                                        \
+            goto done;                                                        \
         }                                                                     \
         self->param.node_depth = node_depth;                                  \
                                                                               \
@@ -296,76 +1191,60 @@ static char *kwlist[] = {
             PyErr_Format(PyExc_ValueError,                                    \
                     "inner_size must be between 0 and is %d",                 \
                     bigname##_OUTBYTES);                                      \
-            goto err0;                                                        \
+            goto done;                                                        \
         }                                                                     \
         self->param.inner_length = inner_size;                                \
                                                                               \
-        /* Set key length. */                                                 \
-        if (key.buf != NULL && key.len > 0) {                                 \
-            if (key.len > bigname##_KEYBYTES) {                               \
-                PyErr_Format(PyExc_ValueError,                                \
-                    "maximum key length is %d bytes",                         \
-                    bigname##_KEYBYTES);                                      \
-                goto err0;                                                    \
-            }                                                                 \
-            self->param.key_length = key.len;                                 \
-        }                                                                     \
-                                                                              \
-        /* Initialize hash state. */                                          \
-        if (name##_init_param(&self->state, &self->param) < 0) {              \
-            PyErr_SetString(PyExc_RuntimeError,                               \
-                    "error initializing hash state");                         \
-            goto err0;                                                        \
-        }                                                                     \
-                                                                              \
-        /* Set last node flag (must come after initialization). */            \
+        /* Set last node flag (kept by initialization). */                    \
         self->state.last_node = (last_node_obj != NULL &&                     \
                     PyObject_IsTrue(last_node_obj));                          \
                                                                               \
-        /* Process key block if any. */                                       \
-        if (key.buf != NULL && key.len > 0) {                                 \
-            uint8_t block[bigname##_BLOCKBYTES];                              \
-            memset(block, 0, sizeof(block));                                  \
-            memcpy(block, key.buf, key.len);                                  \
-            name##_update(&self->state, block, sizeof(block));                \
-            secure_zero_memory(block, sizeof(block));                         \
-        }                                                                     \
-                                                                              \
-        /* Process initial data if any. */                                    \
-        if (data != NULL) {                                                   \
-            if (!getbuffer(data, &buf))                                       \
-                goto err0;                                                    \
+        ok = name##_init_state(self, &key, data, keybuf);                     \
                                                                               \
-            if (buf.len >= GIL_MINSIZE) {                                     \
-                Py_BEGIN_ALLOW_THREADS                                        \
-                name##_update(&self->state, buf.buf, buf.len);                \
-                Py_END_ALLOW_THREADS                                          \
-            } else {                                                          \
-                name##_update(&self->state, buf.buf, buf.len);                \
-            }                                                                 \
-            PyBuffer_Release(&buf);                                           \
-        }                                                                     \
+    done:                                                                     \
+        release_param_buffers(&key, &salt, &person);                          \
+        return ok;                                                            \
+    }
+
+
+static char *p_kwlist[] = {
+    "data", "digest_size", "key", "salt", "person", NULL
+};
+
+#define DECL_INIT_BLAKE2P_OBJECT(name, bigname)                               \
+    static int                                                                \
+    init_##name##Object(name##Object *self, PyObject *args, PyObject *kw,     \
+                        blake2_key *keybuf)                                   \
+    {                                                                         \
+        Py_buffer key, salt, person;                                          \
+        PyObject *data = NULL;                                                \
+        int digest_size = bigname##_OUTBYTES;                                 \
+        int ok = 0;                                                           \
                                                                               \
-        /* Release buffers. */                                                \
-        if (key.buf != NULL)                                                  \
-            PyBuffer_Release(&key);                                           \
-        if (salt.buf != NULL)                                                 \
-            PyBuffer_Release(&salt);                                          \
-        if (person.buf != NULL)                                               \
-            PyBuffer_Release(&person);                                        \
+        /* Initialize buffers. */                                             \
+        key.buf = salt.buf = person.buf = NULL;                               \
+        self->key = NULL;                                                     \
                                                                               \
-        return 1;                                                             \
+        /* Parse arguments. */                                                \
+        if (!PyArg_ParseTupleAndKeywords(args, kw,                            \
+                    "|"          /* following arguments are optional */       \
+                    "O"          /* `data` as PyObject */                     \
+                    "i"          /* `digest_size` as int */                   \
+                    BYTES_FMT"*" /* `key` as Py_buffer */                     \
+                    BYTES_FMT"*" /* `salt` as Py_buffer */                    \
+                    BYTES_FMT"*" /* `person` as Py_buffer */                  \
+                    ":"#name"",  /* function name for errors */               \
+                    p_kwlist, &data, &digest_size, &key, &salt, &person))     \
+            goto done;                                                        \
                                                                               \
-    err0:                                                                     \
-        /* Error: release buffers. */                                         \
-        if (key.buf != NULL)                                                  \
-            PyBuffer_Release(&key);                                           \
-        if (salt.buf != NULL)                                                 \
-            PyBuffer_Release(&salt);                                          \
-        if (person.buf != NULL)                                               \
-            PyBuffer_Release(&person);                                        \
+        /* Tree parameters are set by initialization. */                      \
+        if (name##_set_common_params(self, digest_size, &key, &salt,          \
+                                     &person))                                \
+            ok = name##_init_state(self, &key, data, keybuf);                 \
                                                                               \
-        return 0;                                                             \
+    done:                                                                     \
+        release_param_buffers(&key, &salt, &person);                          \
+        return ok;                                                            \
     }
 
 
@@ -388,11 +1267,152 @@ static char *kwlist[] = {
         ACQUIRE_LOCK(self);                                     \
         cpy->param = self->param;                               \
         cpy->state = self->state;                               \
+        cpy->finalized = self->finalized;                       \
+        cpy->key = key_incref(self->key);                       \
         RELEASE_LOCK(self);                                     \
         return (PyObject *)cpy;                                 \
     }
 
 
+static char *state_bytes_kwlist[] = { "include_key", NULL };
+
+#define DECL_PY_BLAKE2_STATE_BYTES(name)                                      \
+    PyDoc_STRVAR(py_##name##_state_bytes__doc__,                              \
+    "state_bytes(include_key=False) -> bytes\n"                               \
+    "\n"                                                                      \
+    "Return the parameters and state of the hash object serialized in a\n"    \
+    "portable format, from which " #name "_from_state() creates an object\n"  \
+    "that continues hashing where this one is now. The key is included\n"     \
+    "only if include_key is true; without it, the state of a keyed object\n"  \
+    "can't be serialized before data is added, and the restored object\n"     \
+    "can't be reset.");                                                       \
+                                                                              \
+    static PyObject *                                                         \
+    name##_state_bytes(name##Object *self, int include_key)                   \
+    {                                                                         \
+        PyObject *result;                                                     \
+        size_t keylen = 0;                                                    \
+        uint8_t *p;                                                           \
+                                                                              \
+        if (include_key && self->key != NULL)                                 \
+            keylen = self->key->len;                                          \
+        else if (include_key && self->param.key_length > 0) {                 \
+            PyErr_SetString(PyExc_ValueError,                                 \
+                    "the key of the hash object wasn't restored");            \
+            return NULL;                                                      \
+        }                                                                     \
+                                                                              \
+        result = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(NULL,                    \
+                STATE_HEADER_SIZE(#name) + sizeof(self->param) +              \
+                name##_state_size + 1 + keylen);                              \
+        if (result == NULL)                                                   \
+            return NULL;                                                      \
+        p = (uint8_t *)PyBytes_AS_STRING(result);                             \
+                                                                              \
+        ACQUIRE_LOCK(self);                                                   \
+        if (self->finalized) {                                                \
+            RELEASE_LOCK(self);                                               \
+            Py_DECREF(result);                                                \
+            return finalized_error();                                         \
+        }                                                                     \
+        if (keylen == 0 && self->param.key_length > 0 &&                      \
+                name##_key_buffered(&self->state)) {                          \
+            RELEASE_LOCK(self);                                               \
+            Py_DECREF(result);                                                \
+            PyErr_SetString(PyExc_ValueError, "the state of a keyed hash "    \
+                    "object holds the key until data is added; "              \
+                    "use include_key=True");                                  \
+            return NULL;                                                      \
+        }                                                                     \
+        p = pack_state_header(p, #name);                                      \
+        memcpy(p, &self->param, sizeof(self->param));                         \
+        p = name##_pack_state(p + sizeof(self->param), &self->state);         \
+        RELEASE_LOCK(self);                                                   \
+                                                                              \
+        *p++ = (uint8_t)keylen;                                               \
+        if (keylen > 0)                                                       \
+            memcpy(p, self->key->data, keylen);                               \
+        return result;                                                        \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_state_bytes(name##Object *self, PyObject *args,               \
+                            PyObject *kw)                                     \
+    {                                                                         \
+        PyObject *include_key_obj = NULL;                                     \
+        int include_key = 0;                                                  \
+                                                                              \
+        if (!PyArg_ParseTupleAndKeywords(args, kw, "|O:state_bytes",          \
+                                         state_bytes_kwlist,                  \
+                                         &include_key_obj))                   \
+            return NULL;                                                      \
+                                                                              \
+        if (include_key_obj != NULL &&                                        \
+                (include_key = PyObject_IsTrue(include_key_obj)) < 0)         \
+            return NULL;                                                      \
+                                                                              \
+        return name##_state_bytes(self, include_key);                         \
+    }                                                                         \
+                                                                              \
+    /* Pickles never include the key. */                                      \
+    static PyObject *                                                         \
+    py_##name##_reduce(name##Object *self, PyObject *unused)                  \
+    {                                                                         \
+        return reduce_state(name##_state_bytes(self, 0),                      \
+                            #name "_from_state");                             \
+    }
+
+
+#define DECL_PY_BLAKE2_FROM_STATE(name, bigname)                              \
+    PyDoc_STRVAR(py_##name##_from_state__doc__,                               \
+    #name "_from_state(state) -> " #name " object\n"                          \
+    "\n"                                                                      \
+    "Return a new " #name " hash object with the parameters, state and\n"     \
+    "key, if included, serialized by state_bytes().");                        \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_from_state(PyObject *self, PyObject *arg)                     \
+    {                                                                         \
+        name##Object *obj = NULL;                                             \
+        const uint8_t *p, *end;                                               \
+        Py_buffer buf;                                                        \
+        size_t keylen;                                                        \
+                                                                              \
+        if (!getbuffer(arg, &buf))                                            \
+            return NULL;                                                      \
+        end = (const uint8_t *)buf.buf + buf.len;                             \
+        p = unpack_state_header(buf.buf, buf.len, #name);                     \
+        if (p == NULL || (obj = new_##name##Object()) == NULL)                \
+            goto err0;                                                        \
+                                                                              \
+        if ((size_t)(end - p) < sizeof(obj->param) + name##_state_size + 1)   \
+            goto invalid;                                                     \
+        memcpy(&obj->param, p, sizeof(obj->param));                           \
+        p = name##_unpack_state(p + sizeof(obj->param), &obj->state);         \
+        if (p == NULL)                                                        \
+            goto invalid;                                                     \
+        keylen = *p++;                                                        \
+        if (obj->param.digest_length == 0 ||                                  \
+                obj->param.digest_length > bigname##_OUTBYTES ||              \
+                keylen > bigname##_KEYBYTES ||                                \
+                (keylen != 0 && keylen != obj->param.key_length) ||           \
+                (size_t)(end - p) != keylen)                                  \
+            goto invalid;                                                     \
+        if (keylen > 0 && (obj->key = new_key(p, keylen)) == NULL)            \
+            goto err0;                                                        \
+                                                                              \
+        PyBuffer_Release(&buf);                                               \
+        return (PyObject *)obj;                                               \
+                                                                              \
+    invalid:                                                                  \
+        PyErr_SetString(PyExc_ValueError, "invalid " #name " state");         \
+    err0:                                                                     \
+        Py_XDECREF(obj);                                                      \
+        PyBuffer_Release(&buf);                                               \
+        return NULL;                                                          \
+    }
+
+
 /*
  * Macro used inside DECL_PY_BLAKE2_UPDATE:
  */
@@ -408,10 +1428,11 @@ static char *kwlist[] = {
     if (self->lock != NULL) {                                       \
        Py_BEGIN_ALLOW_THREADS                                       \
        PyThread_acquire_lock(self->lock, 1);                        \
-       name##_update(&self->state, buf.buf, buf.len);               \
+       if (!(finalized = self->finalized))                          \
+           name##_update_nogil(&self->state, buf.buf, buf.len);     \
        PyThread_release_lock(self->lock);                           \
        Py_END_ALLOW_THREADS                                         \
-    } else {                                                        \
+    } else if (!(finalized = self->finalized)) {                    \
         name##_update(&self->state, buf.buf, buf.len);              \
     }                                                               \
 } while (0)
@@ -421,7 +1442,8 @@ static char *kwlist[] = {
  * just update hash object with buffer.
  */
 # define INNER_UPDATE(name) do {                                    \
-    name##_update(&self->state, buf.buf, buf.len);                  \
+    if (!(finalized = self->finalized))                             \
+        name##_update(&self->state, buf.buf, buf.len);              \
 } while (0)
 
 #endif /* !WITH_THREAD */
@@ -433,13 +1455,10 @@ static char *kwlist[] = {
     "as buffer of bytes.");                                                 \
                                                                             \
     static PyObject *                                                       \
-    py_##name##_update(name##Object *self, PyObject *args)                  \
+    py_##name##_update(name##Object *self, PyObject *obj)                   \
     {                                                                       \
-        PyObject  *obj;                                                     \
         Py_buffer buf;                                                      \
-                                                                            \
-        if (!PyArg_ParseTuple(args, "O:update", &obj))                      \
-            return NULL;                                                    \
+        int finalized;                                                      \
                                                                             \
         if (!getbuffer(obj, &buf))                                          \
             return NULL;                                                    \
@@ -447,6 +1466,9 @@ static char *kwlist[] = {
         INNER_UPDATE(name);                                                 \
         PyBuffer_Release(&buf);                                             \
                                                                             \
+        if (finalized)                                                      \
+            return finalized_error();                                       \
+                                                                            \
         Py_INCREF(Py_None);                                                 \
         return Py_None;                                                     \
     }
@@ -461,11 +1483,18 @@ static char *kwlist[] = {
     {                                                                       \
         uint8_t digest[bigname##_OUTBYTES];                                 \
         name##_state state_cpy;                                             \
+        int err;                                                            \
                                                                             \
         ACQUIRE_LOCK(self);                                                 \
+        if (self->finalized) {                                              \
+            RELEASE_LOCK(self);                                             \
+            return finalized_error();                                       \
+        }                                                                   \
         state_cpy = self->state;                                            \
-        name##_final(&state_cpy, digest, self->param.digest_length);        \
+        err = name##_final(&state_cpy, digest, self->param.digest_length);  \
         RELEASE_LOCK(self);                                                 \
+        if (err != 0)                                                       \
+            return final_error();                                           \
         return COMPAT_PYBYTES_FROM_STRING_AND_SIZE((const char *)digest,    \
                 self->param.digest_length);                                 \
     }
@@ -476,65 +1505,377 @@ static char *kwlist[] = {
     "Like digest() except the digest is returned as a string of double "    \
     "length, containing only hexadecimal digits.");                         \
                                                                             \
+    PyDoc_STRVAR(py_##name##_hexdigest_bytes__doc__,                        \
+    "Like hexdigest() except the digits are returned as ASCII bytes.");     \
+                                                                            \
     static PyObject *                                                       \
-    py_##name##_hexdigest(name##Object *self, PyObject *unused)             \
+    name##_hexdigest(name##Object *self,                                    \
+                     PyObject *(*encode)(const uint8_t *, size_t))          \
     {                                                                       \
         uint8_t digest[bigname##_OUTBYTES];                                 \
-        char hexdigest[sizeof(digest) * 2];                                 \
         name##_state state_cpy;                                             \
+        int err;                                                            \
                                                                             \
         ACQUIRE_LOCK(self);                                                 \
+        if (self->finalized) {                                              \
+            RELEASE_LOCK(self);                                             \
+            return finalized_error();                                       \
+        }                                                                   \
         state_cpy = self->state;                                            \
-        name##_final(&state_cpy, digest, self->param.digest_length);        \
-        tohex(hexdigest, digest, self->param.digest_length);                \
+        err = name##_final(&state_cpy, digest, self->param.digest_length);  \
         RELEASE_LOCK(self);                                                 \
-        return COMPAT_PYSTRING_FROM_STRING_AND_SIZE((const char *)hexdigest,\
-                self->param.digest_length * 2);                             \
+        if (err != 0)                                                       \
+            return final_error();                                           \
+        return encode(digest, self->param.digest_length);                   \
+    }                                                                       \
+                                                                            \
+    static PyObject *                                                       \
+    py_##name##_hexdigest(name##Object *self, PyObject *unused)             \
+    {                                                                       \
+        return name##_hexdigest(self, hex_string);                          \
+    }                                                                       \
+                                                                            \
+    static PyObject *                                                       \
+    py_##name##_hexdigest_bytes(name##Object *self, PyObject *unused)       \
+    {                                                                       \
+        return name##_hexdigest(self, hex_bytes);                           \
     }
 
 
-#define DECL_PY_BLAKE2_METHODS(name)                                    \
-    static PyMethodDef name##_methods[] = {                             \
-        {"copy", (PyCFunction)py_##name##_copy, METH_NOARGS,            \
-            py_##name##_copy__doc__},                                   \
-        {"digest", (PyCFunction)py_##name##_digest, METH_NOARGS,        \
-            py_##name##_digest__doc__},                                 \
-        {"hexdigest", (PyCFunction)py_##name##_hexdigest, METH_NOARGS,  \
-            py_##name##_hexdigest__doc__},                              \
-        {"update", (PyCFunction)py_##name##_update, METH_VARARGS,       \
-            py_##name##_update__doc__},                                 \
-        {NULL, NULL}                                                    \
-    };
-
-/*
- * Getters.
- */
-
-#define DECL_PY_BLAKE2_GET_NAME(name)                       \
-    static PyObject *                                       \
-    py_##name##_get_name(name##Object *self, void *closure) \
-    {                                                       \
-        return COMPAT_PYSTRING_FROM_STRING("" #name "");    \
+#define DECL_PY_BLAKE2_RESET(name)                                      \
+    PyDoc_STRVAR(py_##name##_reset__doc__,                              \
+    "Reset the hash object to its initial state, without data.");       \
+                                                                        \
+    static PyObject *                                                   \
+    py_##name##_reset(name##Object *self, PyObject *unused)             \
+    {                                                                   \
+        int ok;                                                         \
+                                                                        \
+        /* Keyed objects restored without the key can't start over. */  \
+        if (self->key == NULL && self->param.key_length > 0) {          \
+            PyErr_SetString(PyExc_ValueError,                           \
+                    "the key of the hash object wasn't restored");      \
+            return NULL;                                                \
+        }                                                               \
+                                                                        \
+        ACQUIRE_LOCK(self);                                             \
+        ok = name##_reset_state(self);                                  \
+        self->finalized = !ok;                                          \
+        RELEASE_LOCK(self);                                             \
+                                                                        \
+        if (!ok) {                                                      \
+            PyErr_SetString(PyExc_RuntimeError,                         \
+                    "error initializing hash state");                   \
+            return NULL;                                                \
+        }                                                               \
+        Py_INCREF(Py_None);                                             \
+        return Py_None;                                                 \
     }
 
 
-#define DECL_PY_BLAKE2_GET_BLOCK_SIZE(name, bigname)                \
-    static PyObject *                                               \
-    py_##name##_get_block_size(name##Object *self, void *closure)   \
-    {                                                               \
-        return COMPAT_PYINT_FROM_LONG(bigname##_BLOCKBYTES);        \
-    }
-
+static char *digest_into_kwlist[] = { "buffer", "offset", "finalize", NULL };
 
-#define DECL_PY_BLAKE2_GET_DIGEST_SIZE(name)                        \
-    static PyObject *                                               \
-    py_##name##_get_digest_size(name##Object *self, void *closure)  \
-    {                                                               \
-        return COMPAT_PYINT_FROM_LONG(self->param.digest_length);   \
+#define DECL_PY_BLAKE2_DIGEST_INTO(name)                                      \
+    PyDoc_STRVAR(py_##name##_digest_into__doc__,                              \
+    "digest_into(buffer, offset=0, finalize=False) -> digest_size\n"          \
+    "\n"                                                                      \
+    "Write the digest of the data so far into the writable buffer at\n"       \
+    "offset. If finalize is true, the hash object is finalized in place\n"    \
+    "as with finalize(), which avoids copying its state.");                   \
+                                                                              \
+    static PyObject *                                                         \
+    name##_digest_into(name##Object *self, PyObject *out_obj,                 \
+                       Py_ssize_t offset, PyObject *finalize_obj)             \
+    {                                                                         \
+        Py_buffer out;                                                        \
+        name##_state state_cpy;                                               \
+        int finalize = 0, err;                                                \
+                                                                              \
+        if (finalize_obj != NULL &&                                           \
+                (finalize = PyObject_IsTrue(finalize_obj)) < 0)               \
+            return NULL;                                                      \
+                                                                              \
+        if (PyObject_GetBuffer(out_obj, &out, PyBUF_WRITABLE) < 0)            \
+            return NULL;                                                      \
+                                                                              \
+        if (offset < 0 || offset > out.len ||                                 \
+                out.len - offset < self->param.digest_length) {               \
+            PyErr_SetString(PyExc_ValueError,                                 \
+                    "buffer too small for digest at offset");                 \
+            PyBuffer_Release(&out);                                           \
+            return NULL;                                                      \
+        }                                                                     \
+                                                                              \
+        ACQUIRE_LOCK(self);                                                   \
+        if (self->finalized) {                                                \
+            RELEASE_LOCK(self);                                               \
+            PyBuffer_Release(&out);                                           \
+            return finalized_error();                                         \
+        }                                                                     \
+        if (finalize) {                                                       \
+            err = name##_final(&self->state, (uint8_t *)out.buf + offset,     \
+                    self->param.digest_length);                               \
+            self->finalized = (err == 0);                                     \
+        } else {                                                              \
+            state_cpy = self->state;                                          \
+            err = name##_final(&state_cpy, (uint8_t *)out.buf + offset,       \
+                    self->param.digest_length);                               \
+        }                                                                     \
+        RELEASE_LOCK(self);                                                   \
+        PyBuffer_Release(&out);                                               \
+        if (err != 0)                                                         \
+            return final_error();                                             \
+        return COMPAT_PYINT_FROM_LONG(self->param.digest_length);             \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_digest_into(name##Object *self, PyObject *args, PyObject *kw) \
+    {                                                                         \
+        PyObject *out_obj, *finalize_obj = NULL;                              \
+        Py_ssize_t offset = 0;                                                \
+                                                                              \
+        if (!PyArg_ParseTupleAndKeywords(args, kw, "O|nO:digest_into",        \
+                                         digest_into_kwlist, &out_obj,        \
+                                         &offset, &finalize_obj))             \
+            return NULL;                                                      \
+                                                                              \
+        return name##_digest_into(self, out_obj, offset, finalize_obj);       \
     }
 
 
-#define DECL_PY_BLAKE2_GETSETTERS(name)                             \
+static char *update_from_fd_kwlist[] = { "fd", "length", "bufsize", NULL };
+
+#define DECL_PY_BLAKE2_UPDATE_FROM_FD(name)                                   \
+    PyDoc_STRVAR(py_##name##_update_from_fd__doc__,                           \
+    "update_from_fd(fd, length=None, bufsize=1048576) -> number of bytes\n"   \
+    "\n"                                                                      \
+    "Update the hash object with up to length bytes (all if None) read\n"     \
+    "from the file descriptor fd at its current offset, and return their\n"   \
+    "number. The GIL is released while the next bufsize bytes are read on\n"  \
+    "another thread and the previous ones are hashed. If reading fails,\n"    \
+    "the hash object keeps the bytes read before, whose number is the\n"      \
+    "nread attribute of the exception.");                                     \
+                                                                              \
+    static PyObject *                                                         \
+    name##_update_from_fd(name##Object *self, int fd, PyObject *length_obj,   \
+                          Py_ssize_t bufsize)                                 \
+    {                                                                         \
+        PY_LONG_LONG value;                                                   \
+        uint64_t length = PYBLAKE2_UNTIL_EOF, nread;                          \
+        int err;                                                              \
+                                                                              \
+        if (fd < 0) {                                                         \
+            PyErr_SetString(PyExc_ValueError, "invalid file descriptor");     \
+            return NULL;                                                      \
+        }                                                                     \
+        if (length_obj != Py_None) {                                          \
+            value = PyLong_AsLongLong(length_obj);                            \
+            if (value == -1 && PyErr_Occurred())                              \
+                return NULL;                                                  \
+            if (value < 0) {                                                  \
+                PyErr_SetString(PyExc_ValueError,                             \
+                        "length must not be negative");                       \
+                return NULL;                                                  \
+            }                                                                 \
+            length = (uint64_t)value;                                         \
+        }                                                                     \
+        if (bufsize <= 0) {                                                   \
+            PyErr_SetString(PyExc_ValueError, "bufsize must be positive");    \
+            return NULL;                                                      \
+        }                                                                     \
+                                                                              \
+        ENSURE_LOCK(self);                                                    \
+        ACQUIRE_LOCK(self);                                                   \
+        if (self->finalized) {                                                \
+            RELEASE_LOCK(self);                                               \
+            return finalized_error();                                         \
+        }                                                                     \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        err = pyblake2_stream_fd(fd, length, (size_t)bufsize,                 \
+                                 name##_update_data, &self->state, &nread);   \
+        Py_END_ALLOW_THREADS                                                  \
+        RELEASE_LOCK(self);                                                   \
+                                                                              \
+        if (err != 0)                                                         \
+            return read_error(err, nread);                                    \
+        return PyLong_FromUnsignedLongLong(nread);                            \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_update_from_fd(name##Object *self, PyObject *args,            \
+                               PyObject *kw)                                  \
+    {                                                                         \
+        PyObject *length_obj = Py_None;                                       \
+        Py_ssize_t bufsize = STREAM_BUFSIZE;                                  \
+        int fd;                                                               \
+                                                                              \
+        if (!PyArg_ParseTupleAndKeywords(args, kw, "i|On:update_from_fd",     \
+                                         update_from_fd_kwlist, &fd,          \
+                                         &length_obj, &bufsize))              \
+            return NULL;                                                      \
+                                                                              \
+        return name##_update_from_fd(self, fd, length_obj, bufsize);          \
+    }
+
+
+#define DECL_PY_BLAKE2_FINALIZE(name, bigname)                                \
+    PyDoc_STRVAR(py_##name##_finalize__doc__,                                 \
+    "Return the digest of the data so far and finalize the hash object,\n"    \
+    "which can't be updated or digested afterwards.");                        \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_finalize(name##Object *self, PyObject *unused)                \
+    {                                                                         \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+        int err;                                                              \
+                                                                              \
+        ACQUIRE_LOCK(self);                                                   \
+        if (self->finalized) {                                                \
+            RELEASE_LOCK(self);                                               \
+            return finalized_error();                                         \
+        }                                                                     \
+        err = name##_final(&self->state, digest, self->param.digest_length);  \
+        self->finalized = (err == 0);                                         \
+        RELEASE_LOCK(self);                                                   \
+        if (err != 0)                                                         \
+            return final_error();                                             \
+        return COMPAT_PYBYTES_FROM_STRING_AND_SIZE((const char *)digest,      \
+                self->param.digest_length);                                   \
+    }
+
+
+/*
+ * Methods taking arguments other than data check the common forms of them
+ * here, leaving the rest, and error reporting, to the full parser.
+ */
+#ifdef HAVE_FASTCALL
+# define DECL_PY_BLAKE2_METHODS_FAST(name)                                    \
+    static PyObject *                                                         \
+    py_##name##_digest_into_fast(name##Object *self, PyObject *const *args,   \
+                                 Py_ssize_t nargs, PyObject *kwnames)         \
+    {                                                                         \
+        PyObject *argv[3];                                                    \
+        Py_ssize_t offset = 0;                                                \
+                                                                              \
+        if (!get_fast_kwargs(args, nargs, kwnames, digest_into_kwlist,        \
+                             argv) || argv[0] == NULL ||                      \
+                (argv[1] != NULL && !PyLong_CheckExact(argv[1])))             \
+            return call_with_args((PyObject *)self, args, nargs, kwnames,     \
+                                  (varargs_func)py_##name##_digest_into);     \
+                                                                              \
+        if (argv[1] != NULL &&                                                \
+                (offset = PyLong_AsSsize_t(argv[1])) == -1 &&                 \
+                PyErr_Occurred())                                             \
+            return NULL;                                                      \
+        return name##_digest_into(self, argv[0], offset, argv[2]);            \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_state_bytes_fast(name##Object *self, PyObject *const *args,   \
+                                 Py_ssize_t nargs, PyObject *kwnames)         \
+    {                                                                         \
+        PyObject *argv[1];                                                    \
+        int include_key = 0;                                                  \
+                                                                              \
+        if (!get_fast_kwargs(args, nargs, kwnames, state_bytes_kwlist,        \
+                             argv))                                           \
+            return call_with_args((PyObject *)self, args, nargs, kwnames,     \
+                                  (varargs_func)py_##name##_state_bytes);     \
+                                                                              \
+        if (argv[0] != NULL &&                                                \
+                (include_key = PyObject_IsTrue(argv[0])) < 0)                 \
+            return NULL;                                                      \
+        return name##_state_bytes(self, include_key);                         \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_update_from_fd_fast(name##Object *self,                       \
+                                    PyObject *const *args, Py_ssize_t nargs,  \
+                                    PyObject *kwnames)                        \
+    {                                                                         \
+        PyObject *argv[3];                                                    \
+        Py_ssize_t bufsize = STREAM_BUFSIZE;                                  \
+        long fd = -1;                                                         \
+        int overflow = 0;                                                     \
+                                                                              \
+        if (get_fast_kwargs(args, nargs, kwnames, update_from_fd_kwlist,      \
+                            argv) && argv[0] != NULL &&                       \
+                PyLong_CheckExact(argv[0]))                                   \
+            fd = PyLong_AsLongAndOverflow(argv[0], &overflow);                \
+        if (fd < 0 || fd > INT_MAX || overflow ||                             \
+                (argv[2] != NULL && !PyLong_CheckExact(argv[2])))             \
+            return call_with_args((PyObject *)self, args, nargs, kwnames,     \
+                                  (varargs_func)py_##name##_update_from_fd);  \
+                                                                              \
+        if (argv[2] != NULL &&                                                \
+                (bufsize = PyLong_AsSsize_t(argv[2])) == -1 &&                \
+                PyErr_Occurred())                                             \
+            return NULL;                                                      \
+        return name##_update_from_fd(self, (int)fd,                           \
+                                     argv[1] != NULL ? argv[1] : Py_None,     \
+                                     bufsize);                                \
+    }
+#else
+# define DECL_PY_BLAKE2_METHODS_FAST(name)
+#endif
+
+
+#define DECL_PY_BLAKE2_METHODS(name)                                    \
+    static PyMethodDef name##_methods[] = {                             \
+        {"copy", (PyCFunction)py_##name##_copy, METH_NOARGS,            \
+            py_##name##_copy__doc__},                                   \
+        {"digest", (PyCFunction)py_##name##_digest, METH_NOARGS,        \
+            py_##name##_digest__doc__},                                 \
+        {"hexdigest", (PyCFunction)py_##name##_hexdigest, METH_NOARGS,  \
+            py_##name##_hexdigest__doc__},                              \
+        {"hexdigest_bytes", (PyCFunction)py_##name##_hexdigest_bytes,   \
+            METH_NOARGS, py_##name##_hexdigest_bytes__doc__},           \
+        {"digest_into", FASTCALL_METHOD(py_##name##_digest_into),       \
+            py_##name##_digest_into__doc__},                            \
+        {"finalize", (PyCFunction)py_##name##_finalize, METH_NOARGS,    \
+            py_##name##_finalize__doc__},                               \
+        {"reset", (PyCFunction)py_##name##_reset, METH_NOARGS,          \
+            py_##name##_reset__doc__},                                  \
+        {"state_bytes", FASTCALL_METHOD(py_##name##_state_bytes),       \
+            py_##name##_state_bytes__doc__},                            \
+        {"__reduce__", (PyCFunction)py_##name##_reduce, METH_NOARGS,    \
+            NULL},                                                      \
+        {"update", (PyCFunction)py_##name##_update, METH_O,             \
+            py_##name##_update__doc__},                                 \
+        {"update_from_fd", FASTCALL_METHOD(py_##name##_update_from_fd), \
+            py_##name##_update_from_fd__doc__},                         \
+        {NULL, NULL}                                                    \
+    };
+
+/*
+ * Getters.
+ */
+
+#define DECL_PY_BLAKE2_GET_NAME(name)                       \
+    static PyObject *                                       \
+    py_##name##_get_name(name##Object *self, void *closure) \
+    {                                                       \
+        return COMPAT_PYSTRING_FROM_STRING("" #name "");    \
+    }
+
+
+#define DECL_PY_BLAKE2_GET_BLOCK_SIZE(name, bigname)                \
+    static PyObject *                                               \
+    py_##name##_get_block_size(name##Object *self, void *closure)   \
+    {                                                               \
+        return COMPAT_PYINT_FROM_LONG(bigname##_BLOCKBYTES);        \
+    }
+
+
+#define DECL_PY_BLAKE2_GET_DIGEST_SIZE(name)                        \
+    static PyObject *                                               \
+    py_##name##_get_digest_size(name##Object *self, void *closure)  \
+    {                                                               \
+        return COMPAT_PYINT_FROM_LONG(self->param.digest_length);   \
+    }
+
+
+#define DECL_PY_BLAKE2_GETSETTERS(name)                             \
     static PyGetSetDef name##_getsetters[] = {                      \
         {"name", (getter)py_##name##_get_name,                      \
             NULL, NULL, NULL},                                      \
@@ -555,8 +1896,16 @@ static char *kwlist[] = {
         /* Try not to leave state in memory. */                 \
         secure_zero_memory(&obj->param, sizeof(obj->param));    \
         secure_zero_memory(&obj->state, sizeof(obj->state));    \
+        key_decref(obj->key);                                   \
         FREE_LOCK(obj);                                         \
-        PyObject_Del(self);                                     \
+                                                                \
+        if (name##_free_count < FREE_LIST_MAXSIZE) {            \
+            Py_SET_TYPE(obj, (PyTypeObject *)name##_free_list); \
+            name##_free_list = obj;                             \
+            name##_free_count++;                                \
+        } else {                                                \
+            PyObject_Del(self);                                 \
+        }                                                       \
     }
 
 
@@ -607,7 +1956,7 @@ static char *kwlist[] = {
         if (PyErr_Occurred())                                           \
             goto err1;                                                  \
                                                                         \
-        if (!init_##name##Object(obj, args, kwdict))                    \
+        if (!init_##name##Object(obj, args, kwdict, NULL))              \
             goto err1;                                                  \
                                                                         \
         return (PyObject *)obj;                                         \
@@ -619,14 +1968,88 @@ static char *kwlist[] = {
     }
 
 
-#define DECL_BLAKE2_WRAPPER(name, bigname)          \
-    DECL_BLAKE2_STRUCT(name)                        \
-    DECL_NEW_BLAKE2_OBJECT(name)                    \
-    DECL_INIT_BLAKE2_OBJECT(name, bigname)          \
+/*
+ * Constructors called with data and digest_size only, which is the most
+ * common case, skip building and parsing argument tuples.
+ */
+#ifdef HAVE_FASTCALL
+# define DECL_PY_BLAKE2_NEW_FAST(name, bigname)                               \
+    static int                                                                \
+    init_fast_##name##Object(name##Object *self, PyObject *data,              \
+                             int digest_size)                                 \
+    {                                                                         \
+        Py_buffer buf;                                                        \
+                                                                              \
+        if (digest_size <= 0 || digest_size > bigname##_OUTBYTES) {           \
+            PyErr_Format(PyExc_ValueError,                                    \
+                    "digest_size must be between 1 and %d bytes",             \
+                    bigname##_OUTBYTES);                                      \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        memset(&self->param, 0, sizeof(self->param));                         \
+        self->param.digest_length = digest_size;                              \
+        name##_set_defaults(self);                                            \
+                                                                              \
+        if (!name##_reset_state(self)) {                                      \
+            PyErr_SetString(PyExc_RuntimeError,                               \
+                    "error initializing hash state");                         \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        if (data != NULL) {                                                   \
+            if (!getbuffer(data, &buf))                                       \
+                return 0;                                                     \
+                                                                              \
+            if (buf.len >= GIL_MINSIZE) {                                     \
+                Py_BEGIN_ALLOW_THREADS                                        \
+                name##_update_nogil(&self->state, buf.buf, buf.len);          \
+                Py_END_ALLOW_THREADS                                          \
+            } else {                                                          \
+                name##_update(&self->state, buf.buf, buf.len);                \
+            }                                                                 \
+            PyBuffer_Release(&buf);                                           \
+        }                                                                     \
+        return 1;                                                             \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_new_fast(PyObject *self, PyObject *const *args,               \
+                         Py_ssize_t nargs, PyObject *kwnames)                 \
+    {                                                                         \
+        name##Object *obj;                                                    \
+        PyObject *data = NULL;                                                \
+        int digest_size = bigname##_OUTBYTES;                                 \
+                                                                              \
+        if (!get_fast_args(args, nargs, kwnames, &data, &digest_size))        \
+            return call_with_args(self, args, nargs, kwnames,                 \
+                                  py_##name##_new);                           \
+                                                                              \
+        if ((obj = new_##name##Object()) == NULL)                             \
+            return NULL;                                                      \
+                                                                              \
+        if (!init_fast_##name##Object(obj, data, digest_size)) {              \
+            Py_DECREF(obj);                                                   \
+            return NULL;                                                      \
+        }                                                                     \
+        return (PyObject *)obj;                                               \
+    }
+#else
+# define DECL_PY_BLAKE2_NEW_FAST(name, bigname)
+#endif
+
+
+#define DECL_BLAKE2_TYPE(name, bigname)             \
     DECL_PY_BLAKE2_COPY(name)                       \
     DECL_PY_BLAKE2_UPDATE(name)                     \
     DECL_PY_BLAKE2_DIGEST(name, bigname)            \
     DECL_PY_BLAKE2_HEXDIGEST(name, bigname)         \
+    DECL_PY_BLAKE2_DIGEST_INTO(name)                \
+    DECL_PY_BLAKE2_UPDATE_FROM_FD(name)             \
+    DECL_PY_BLAKE2_FINALIZE(name, bigname)          \
+    DECL_PY_BLAKE2_RESET(name)                      \
+    DECL_PY_BLAKE2_STATE_BYTES(name)                \
+    DECL_PY_BLAKE2_METHODS_FAST(name)               \
     DECL_PY_BLAKE2_METHODS(name)                    \
     DECL_PY_BLAKE2_GET_NAME(name)                   \
     DECL_PY_BLAKE2_GET_BLOCK_SIZE(name, bigname)    \
@@ -634,95 +2057,1921 @@ static char *kwlist[] = {
     DECL_PY_BLAKE2_GETSETTERS(name)                 \
     DECL_PY_BLAKE2_DEALLOC(name)                    \
     DECL_PY_BLAKE2_TYPE_OBJECT(name)                \
-    DECL_PY_BLAKE2_NEW(name)
+    DECL_PY_BLAKE2_NEW(name)                        \
+    DECL_PY_BLAKE2_NEW_FAST(name, bigname)          \
+    DECL_PY_BLAKE2_FROM_STATE(name, bigname)
+
+#define DECL_BLAKE2_WRAPPER(name, bigname)          \
+    DECL_BLAKE2_STRUCT(name)                        \
+    DECL_BLAKE2_UPDATE_NOGIL(name)                  \
+    DECL_BLAKE2_UPDATE_DATA(name)                   \
+    DECL_BLAKE2_RESET_STATE(name, bigname)          \
+    DECL_BLAKE2_STATE_CODEC(name, bigname)          \
+    DECL_BLAKE2_SET_DEFAULTS(name)                  \
+    DECL_NEW_BLAKE2_OBJECT(name)                    \
+    DECL_INIT_BLAKE2_COMMON(name, bigname)          \
+    DECL_INIT_BLAKE2_OBJECT(name, bigname)          \
+    DECL_BLAKE2_TYPE(name, bigname)
+
+/* Parallel variants share parameter block type and limits with the
+ * underlying hash function. */
+#define DECL_BLAKE2P_WRAPPER(name, leafname, bigname, leaves)       \
+    DECL_BLAKE2_STRUCT(name)                                        \
+    DECL_BLAKE2P_UPDATE_NOGIL(name, leafname, bigname, leaves)      \
+    DECL_BLAKE2_UPDATE_DATA(name)                                   \
+    DECL_BLAKE2P_RESET_STATE(name)                                  \
+    DECL_BLAKE2P_STATE_CODEC(name, leafname, bigname, leaves)       \
+    DECL_BLAKE2P_SET_DEFAULTS(name)                                 \
+    DECL_NEW_BLAKE2_OBJECT(name)                                    \
+    DECL_INIT_BLAKE2_COMMON(name, bigname)                          \
+    DECL_INIT_BLAKE2P_OBJECT(name, bigname)                         \
+    DECL_BLAKE2_TYPE(name, bigname)
 
 /*
- * Declare objects.
- * Note: don't forget to update module init function and constants.
+ * One-shot hashing. Hash objects used by it live on the stack and are
+ * never seen by Python, so only their parameters, key and state are set.
+ * Keys are kept on the stack too, since they're never shared.
  */
 
-PyDoc_STRVAR(py_blake2b_new__doc__,
-"blake2b(data=b'', digest_size=64, key=b'', salt=b'', person=b'', "
-"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
-"inner_size=0, last_node=False) -> blake2b object\n"
-"\n"
-"Return a new BLAKE2b hash object.");
+#ifdef HAVE_FASTCALL
+# define DECL_PY_BLAKE2_ONESHOT_FAST(name, bigname)                           \
+    static PyObject *                                                         \
+    py_##name##_oneshot_fast(PyObject *self, PyObject *const *args,           \
+                             Py_ssize_t nargs, PyObject *kwnames)             \
+    {                                                                         \
+        name##Object obj;                                                     \
+        PyObject *data = NULL;                                                \
+        int digest_size = bigname##_OUTBYTES;                                 \
+                                                                              \
+        if (!get_fast_args(args, nargs, kwnames, &data, &digest_size))        \
+            return call_with_args(self, args, nargs, kwnames,                 \
+                                  py_##name##_oneshot);                       \
+                                                                              \
+        obj.key = NULL;                                                       \
+        return name##_oneshot_result(&obj,                                    \
+                init_fast_##name##Object(&obj, data, digest_size));           \
+    }
+#else
+# define DECL_PY_BLAKE2_ONESHOT_FAST(name, bigname)
+#endif
 
-DECL_BLAKE2_WRAPPER(blake2b, BLAKE2B)
+#define DECL_PY_BLAKE2_ONESHOT(name, bigname)                                 \
+    static PyObject *                                                         \
+    name##_oneshot_result(name##Object *self, int ok)                         \
+    {                                                                         \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+        PyObject *result = NULL;                                              \
+                                                                              \
+        if (ok && name##_final(&self->state, digest,                          \
+                               self->param.digest_length) != 0)               \
+            final_error();                                                    \
+        else if (ok)                                                          \
+            result = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(                     \
+                    (const char *)digest, self->param.digest_length);         \
+                                                                              \
+        /* Try not to leave state or key in memory. */                        \
+        secure_zero_memory(&self->param, sizeof(self->param));                \
+        secure_zero_memory(&self->state, sizeof(self->state));                \
+        if (self->key != NULL)                                                \
+            secure_zero_memory(self->key->data, self->key->len);              \
+        return result;                                                        \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_oneshot(PyObject *self, PyObject *args, PyObject *kw)         \
+    {                                                                         \
+        name##Object obj;                                                     \
+        KEY_STORAGE(bigname##_KEYBYTES) keybuf;                               \
+                                                                              \
+        return name##_oneshot_result(&obj,                                    \
+                init_##name##Object(&obj, args, kw, &keybuf.key));            \
+    }                                                                         \
+                                                                              \
+    DECL_PY_BLAKE2_ONESHOT_FAST(name, bigname)
 
+/*
+ * Batch hashing.
+ */
 
-PyDoc_STRVAR(py_blake2s_new__doc__,
-"blake2s(data=b'', digest_size=32, key=b'', salt=b'', person=b'', "
-"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
-"inner_size=0, last_node=False) -> blake2s object\n"
-"\n"
-"Return a new BLAKE2s hash object.");
+/*
+ * Parse arguments of a batch function described by format and kwlist,
+ * leaving other keyword arguments (hash parameters) in *params, a new
+ * dictionary.
+ */
+static int
+parse_batch_args(PyObject *args, PyObject *kw, PyObject **params,
+                 const char *format, char **kwlist, ...)
+{
+    PyObject *own, *value;
+    char **name;
+    va_list va;
+    int ok;
 
-DECL_BLAKE2_WRAPPER(blake2s, BLAKE2S)
+    *params = (kw != NULL) ? PyDict_Copy(kw) : PyDict_New();
+    if (*params == NULL)
+        return 0;
 
+    if ((own = PyDict_New()) == NULL)
+        goto err0;
 
-/*
- * Module.
- */
-static struct PyMethodDef pyblake2_functions[] = {
-    {"blake2b", (PyCFunction)py_blake2b_new, METH_VARARGS|METH_KEYWORDS,
-        py_blake2b_new__doc__},
-    {"blake2s", (PyCFunction)py_blake2s_new, METH_VARARGS|METH_KEYWORDS,
-        py_blake2s_new__doc__},
-    {NULL, NULL}
-};
+    for (name = kwlist; *name != NULL; name++) {
+        value = PyDict_GetItemString(*params, *name);
+        if (value == NULL)
+            continue;
+        if (PyDict_SetItemString(own, *name, value) < 0 ||
+                PyDict_DelItemString(*params, *name) < 0)
+            goto err1;
+    }
 
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef pyblake2_module = {
-    PyModuleDef_HEAD_INIT,
-    "pyblake2",
-    pyblake2__doc__,
-    -1,
-    pyblake2_functions,
-    NULL,
-    NULL,
-    NULL,
-    NULL
-};
-# define INIT_FUNC_NAME PyInit_pyblake2
-# define INIT_ERROR     return NULL
-#else
-# define INIT_FUNC_NAME initpyblake2
-# define INIT_ERROR     return
-#endif
+    va_start(va, kwlist);
+    ok = PyArg_VaParseTupleAndKeywords(args, own, format, kwlist, va);
+    va_end(va);
+    if (!ok)
+        goto err1;
 
-PyMODINIT_FUNC
-INIT_FUNC_NAME(void)
-{
-    PyObject *m;
+    Py_DECREF(own);
+    return 1;
 
-    Py_TYPE(&blake2bType) = &PyType_Type;
-    if (PyType_Ready(&blake2bType) < 0)
-        INIT_ERROR;
+err1:
+    Py_DECREF(own);
+err0:
+    Py_CLEAR(*params);
+    return 0;
+}
 
-    Py_TYPE(&blake2sType) = &PyType_Type;
-    if (PyType_Ready(&blake2sType) < 0)
-        INIT_ERROR;
 
-    /* TODO: do runtime self-check */
-#if PY_MAJOR_VERSION >= 3
-    m = PyModule_Create(&pyblake2_module);
-#else
-    m = Py_InitModule3("pyblake2", pyblake2_functions, pyblake2__doc__);
-#endif
+/*
+ * Hash count <= lanes messages into initialized states S and write
+ * outlen-byte digests to out. Full groups are run through the multi-buffer
+ * API for as many blocks as the shortest message has. hash_group() does the
+ * same starting from copies of one template state.
+ *
+ * Template states of keyed hashes keep the key block buffered, since it is
+ * the last block of an empty message. absorb_key() stores the state after
+ * the key block is compressed and wiped from the buffer, which non-empty
+ * messages start from, so the key block is compressed once and not for
+ * every message.
+ *
+ * Finalizing can't fail here: states are copies of a template initialized
+ * by init_<name>Object(), so they aren't finalized, and outlen is its
+ * checked digest size. final() only fails for a finalized state or an
+ * invalid output length.
+ */
+#define DECL_BLAKE2_HASH_GROUP(name, bigname, lanes)                          \
+    static void                                                               \
+    name##_absorb_key(name##_state *absorbed, const name##_state *tmpl)       \
+    {                                                                         \
+        *absorbed = *tmpl;                                                    \
+        if (absorbed->buflen == bigname##_BLOCKBYTES)                         \
+            name##_flush(absorbed);                                           \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    name##_hash_states(name##_state **S, const uint8_t *const *in,            \
+                       const Py_ssize_t *len, Py_ssize_t count,               \
+                       uint8_t *out, uint8_t outlen)                          \
+    {                                                                         \
+        Py_ssize_t j, nblocks = 0, blocks;                                    \
+                                                                              \
+        for (j = 0; j < count; j++) {                                         \
+            blocks = len[j] / bigname##_BLOCKBYTES;                           \
+            if (j == 0 || blocks < nblocks)                                   \
+                nblocks = blocks;                                             \
+        }                                                                     \
+                                                                              \
+        if (count == lanes && nblocks > 0)                                    \
+            name##_update_x##lanes(S, in, nblocks, bigname##_BLOCKBYTES);     \
+        else                                                                  \
+            nblocks = 0;                                                      \
+                                                                              \
+        for (j = 0; j < count; j++) {                                         \
+            name##_update(S[j], in[j] + nblocks * bigname##_BLOCKBYTES,       \
+                    len[j] - nblocks * bigname##_BLOCKBYTES);                 \
+            name##_final(S[j], out + j * outlen, outlen);                     \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    name##_hash_group(const name##_state *tmpl, const name##_state *absorbed, \
+                      const uint8_t *const *in, const Py_ssize_t *len,        \
+                      Py_ssize_t count, uint8_t *out, uint8_t outlen)         \
+    {                                                                         \
+        name##_state states[lanes];                                           \
+        name##_state *S[lanes];                                               \
+        Py_ssize_t j;                                                         \
+                                                                              \
+        for (j = 0; j < count; j++) {                                         \
+            states[j] = len[j] > 0 ? *absorbed : *tmpl;                       \
+            S[j] = &states[j];                                                \
+        }                                                                     \
+        name##_hash_states(S, in, len, count, out, outlen);                   \
+        secure_zero_memory(states, count * sizeof(states[0]));                \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    name##_hash_buffers(const name##_state *tmpl,                             \
+                        const name##_state *absorbed, const Py_buffer *bufs,  \
+                        Py_ssize_t n, uint8_t *out, uint8_t outlen)           \
+    {                                                                         \
+        const uint8_t *in[lanes];                                             \
+        Py_ssize_t len[lanes];                                                \
+        Py_ssize_t i, j, count;                                               \
+                                                                              \
+        for (i = 0; i < n; i += count) {                                      \
+            count = n - i < lanes ? n - i : lanes;                            \
+            for (j = 0; j < count; j++) {                                     \
+                in[j] = (const uint8_t *)bufs[i + j].buf;                     \
+                len[j] = bufs[i + j].len;                                     \
+            }                                                                 \
+            name##_hash_group(tmpl, absorbed, in, len, count,                 \
+                              out + i * outlen, outlen);                      \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    name##_hash_chunks(const name##_state *tmpl,                              \
+                       const name##_state *absorbed, const uint8_t *data,     \
+                       Py_ssize_t datalen, Py_ssize_t chunk_size,             \
+                       uint8_t *out, uint8_t outlen)                          \
+    {                                                                         \
+        const uint8_t *in[lanes];                                             \
+        Py_ssize_t len[lanes];                                                \
+        Py_ssize_t offset, count;                                             \
+                                                                              \
+        while (datalen > 0) {                                                 \
+            for (count = 0; count < lanes && datalen > 0; count++) {          \
+                in[count] = data;                                             \
+                len[count] = datalen < chunk_size ? datalen : chunk_size;     \
+                offset = len[count];                                          \
+                data += offset;                                               \
+                datalen -= offset;                                            \
+            }                                                                 \
+            name##_hash_group(tmpl, absorbed, in, len, count, out, outlen);   \
+            out += count * outlen;                                            \
+        }                                                                     \
+    }
 
-    /* Add module constants. */
 
-    PyModule_AddIntConstant(m, "BLAKE2B_SALT_SIZE", BLAKE2B_SALTBYTES);
-    PyModule_AddIntConstant(m, "BLAKE2B_PERSON_SIZE", BLAKE2B_PERSONALBYTES);
-    PyModule_AddIntConstant(m, "BLAKE2B_MAX_KEY_SIZE", BLAKE2B_KEYBYTES);
-    PyModule_AddIntConstant(m, "BLAKE2B_MAX_DIGEST_SIZE", BLAKE2B_OUTBYTES);
+/*
+ * Initialize a template object from hash parameters of a batch function.
+ * The key is only kept if keep_key is true, otherwise the template doesn't
+ * need to be freed.
+ */
+#define DECL_INIT_BLAKE2_TEMPLATE(name)                                       \
+    static int                                                                \
+    init_##name##Template(name##Object *tmpl, PyObject *params,               \
+                          const char *fname, int keep_key)                    \
+    {                                                                         \
+        PyObject *empty;                                                      \
+        int ok;                                                               \
+                                                                              \
+        memset(&tmpl->param, 0, sizeof(tmpl->param));                         \
+        memset(&tmpl->state, 0, sizeof(tmpl->state));                         \
+                                                                              \
+        if (PyDict_GetItemString(params, "data") != NULL) {                   \
+            PyErr_Format(PyExc_TypeError,                                     \
+                    "'data' is an invalid keyword argument for %s()", fname); \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        if ((empty = PyTuple_New(0)) == NULL)                                 \
+            return 0;                                                         \
+        ok = init_##name##Object(tmpl, empty, params, NULL);                  \
+        Py_DECREF(empty);                                                     \
+                                                                              \
+        if (!ok || !keep_key) {                                               \
+            key_decref(tmpl->key);                                            \
+            tmpl->key = NULL;                                                 \
+        }                                                                     \
+        return ok;                                                            \
+    }
 
-    PyModule_AddIntConstant(m, "BLAKE2S_SALT_SIZE", BLAKE2S_SALTBYTES);
-    PyModule_AddIntConstant(m, "BLAKE2S_PERSON_SIZE", BLAKE2S_PERSONALBYTES);
-    PyModule_AddIntConstant(m, "BLAKE2S_MAX_KEY_SIZE", BLAKE2S_KEYBYTES);
+
+static char *many_kwlist[] = { "iterable", NULL };
+
+#define DECL_PY_BLAKE2_MANY(name)                                             \
+    static PyObject *                                                         \
+    py_##name##_many(PyObject *self, PyObject *args, PyObject *kw)            \
+    {                                                                         \
+        PyObject *iterable, *params, *seq = NULL, *result = NULL;             \
+        PyObject *digest;                                                     \
+        name##Object tmpl;                                                    \
+        name##_state absorbed;                                                \
+        Py_buffer *bufs = NULL;                                               \
+        uint8_t *digests = NULL;                                              \
+        Py_ssize_t n, i, nbufs = 0, total = 0;                                \
+        uint8_t outlen;                                                       \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, "O:" #name "_many",          \
+                              many_kwlist, &iterable))                        \
+            return NULL;                                                      \
+                                                                              \
+        /* Parse parameters and process key block once. */                    \
+        if (!init_##name##Template(&tmpl, params, #name "_many", 0))          \
+            goto err0;                                                        \
+        name##_absorb_key(&absorbed, &tmpl.state);                            \
+        outlen = tmpl.param.digest_length;                                    \
+                                                                              \
+        seq = PySequence_Fast(iterable,                                       \
+                #name "_many() argument must be iterable");                   \
+        if (seq == NULL)                                                      \
+            goto err0;                                                        \
+        n = PySequence_Fast_GET_SIZE(seq);                                    \
+                                                                              \
+        bufs = PyMem_New(Py_buffer, n > 0 ? n : 1);                           \
+        digests = PyMem_New(uint8_t, n > 0 ? n * outlen : 1);                 \
+        if (bufs == NULL || digests == NULL) {                                \
+            PyErr_NoMemory();                                                 \
+            goto err0;                                                        \
+        }                                                                     \
+                                                                              \
+        for (nbufs = 0; nbufs < n; nbufs++) {                                 \
+            if (!getbuffer(PySequence_Fast_GET_ITEM(seq, nbufs),              \
+                           &bufs[nbufs]))                                     \
+                goto err0;                                                    \
+            total += bufs[nbufs].len;                                         \
+        }                                                                     \
+                                                                              \
+        if (total >= GIL_MINSIZE) {                                           \
+            Py_BEGIN_ALLOW_THREADS                                            \
+            name##_hash_buffers(&tmpl.state, &absorbed, bufs, n, digests,     \
+                                outlen);                                      \
+            Py_END_ALLOW_THREADS                                              \
+        } else {                                                              \
+            name##_hash_buffers(&tmpl.state, &absorbed, bufs, n, digests,     \
+                                outlen);                                      \
+        }                                                                     \
+                                                                              \
+        if ((result = PyList_New(n)) == NULL)                                 \
+            goto err0;                                                        \
+        for (i = 0; i < n; i++) {                                             \
+            digest = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(                     \
+                    (const char *)digests + i * outlen, outlen);              \
+            if (digest == NULL) {                                             \
+                Py_CLEAR(result);                                             \
+                goto err0;                                                    \
+            }                                                                 \
+            PyList_SET_ITEM(result, i, digest);                               \
+        }                                                                     \
+                                                                              \
+    err0:                                                                     \
+        for (i = 0; i < nbufs; i++)                                           \
+            PyBuffer_Release(&bufs[i]);                                       \
+        PyMem_Free(bufs);                                                     \
+        PyMem_Free(digests);                                                  \
+        Py_XDECREF(seq);                                                      \
+        Py_DECREF(params);                                                    \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        secure_zero_memory(&absorbed, sizeof(absorbed));                      \
+        return result;                                                        \
+    }
+
+
+static char *chunks_kwlist[] = { "data", "chunk_size", "out", NULL };
+
+#define DECL_PY_BLAKE2_CHUNKS(name)                                           \
+    static PyObject *                                                         \
+    py_##name##_chunks(PyObject *self, PyObject *args, PyObject *kw)          \
+    {                                                                         \
+        PyObject *data_obj, *out_obj = Py_None, *params, *result = NULL;      \
+        name##Object tmpl;                                                    \
+        name##_state absorbed;                                                \
+        Py_buffer data, out;                                                  \
+        uint8_t *digests;                                                     \
+        Py_ssize_t chunk_size, n, outsize;                                    \
+        uint8_t outlen;                                                       \
+                                                                              \
+        data.buf = out.buf = NULL;                                            \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, "On|O:" #name "_chunks",     \
+                              chunks_kwlist, &data_obj, &chunk_size,          \
+                              &out_obj))                                      \
+            return NULL;                                                      \
+                                                                              \
+        if (!init_##name##Template(&tmpl, params, #name "_chunks", 0))        \
+            goto err0;                                                        \
+        name##_absorb_key(&absorbed, &tmpl.state);                            \
+        outlen = tmpl.param.digest_length;                                    \
+                                                                              \
+        if (chunk_size <= 0) {                                                \
+            PyErr_SetString(PyExc_ValueError, "chunk_size must be positive"); \
+            goto err0;                                                        \
+        }                                                                     \
+                                                                              \
+        if (!getbuffer(data_obj, &data))                                      \
+            goto err0;                                                        \
+                                                                              \
+        n = data.len / chunk_size + (data.len % chunk_size != 0);             \
+        if (n > PY_SSIZE_T_MAX / outlen) {                                    \
+            PyErr_NoMemory();                                                 \
+            goto err0;                                                        \
+        }                                                                     \
+        outsize = n * outlen;                                                 \
+                                                                              \
+        /* Digests go to a new bytes object or to the given buffer. */        \
+        if (out_obj == Py_None) {                                             \
+            result = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(NULL, outsize);      \
+            if (result == NULL)                                               \
+                goto err0;                                                    \
+            digests = (uint8_t *)COMPAT_PYBYTES_AS_STRING(result);            \
+        } else {                                                              \
+            if (PyObject_GetBuffer(out_obj, &out, PyBUF_WRITABLE) < 0) {      \
+                out.buf = NULL;                                               \
+                goto err0;                                                    \
+            }                                                                 \
+            if (out.len < outsize) {                                          \
+                PyErr_Format(PyExc_ValueError,                                \
+                        "out must be at least %zd bytes", outsize);           \
+                goto err0;                                                    \
+            }                                                                 \
+            digests = (uint8_t *)out.buf;                                     \
+            Py_INCREF(out_obj);                                               \
+            result = out_obj;                                                 \
+        }                                                                     \
+                                                                              \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        name##_hash_chunks(&tmpl.state, &absorbed,                            \
+                           (const uint8_t *)data.buf, data.len,               \
+                           chunk_size, digests, outlen);                      \
+        Py_END_ALLOW_THREADS                                                  \
+                                                                              \
+    err0:                                                                     \
+        if (data.buf != NULL)                                                 \
+            PyBuffer_Release(&data);                                          \
+        if (out.buf != NULL)                                                  \
+            PyBuffer_Release(&out);                                           \
+        Py_DECREF(params);                                                    \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        secure_zero_memory(&absorbed, sizeof(absorbed));                      \
+        return result;                                                        \
+    }
+
+#define DECL_BLAKE2_BATCH(name, bigname, lanes)     \
+    DECL_BLAKE2_HASH_GROUP(name, bigname, lanes)    \
+    DECL_INIT_BLAKE2_TEMPLATE(name)                 \
+    DECL_PY_BLAKE2_MANY(name)                       \
+    DECL_PY_BLAKE2_CHUNKS(name)
+
+/*
+ * Tree hashing.
+ */
+
+/* Tree parameters set by tree functions themselves. */
+static char *tree_reserved_kwlist[] = {
+    "node_offset", "node_depth", "last_node", NULL
+};
+
+static char *tree_kwlist[] = {
+    "data", "leaf_size", "fanout", "depth", "inner_size", "threads", NULL
+};
+
+/* One level of a tree being hashed: node i hashes node_size bytes of input
+ * starting at offset i * node_size (the last node may get less). */
+#define DECL_BLAKE2_TREE_STRUCT(name)                                         \
+    typedef struct {                                                          \
+        name##_param param;     /* parameters shared by all nodes */          \
+        const uint8_t *key;     /* param.key_length bytes */                  \
+        const uint8_t *in;                                                    \
+        Py_ssize_t inlen;                                                     \
+        Py_ssize_t node_size;                                                 \
+        Py_ssize_t count;       /* number of nodes */                         \
+        uint8_t *out;           /* digest_length bytes per node */            \
+    } name##_tree_level;
+
+
+#define DECL_BLAKE2_HASH_TREE_NODES(name, bigname, lanes)                     \
+    static void                                                               \
+    name##_hash_tree_nodes(void *arg, size_t start, size_t end)               \
+    {                                                                         \
+        const name##_tree_level *L = (const name##_tree_level *)arg;          \
+        name##_param P = L->param;                                            \
+        name##_state states[lanes];                                           \
+        name##_state *S[lanes];                                               \
+        const uint8_t *in[lanes];                                             \
+        Py_ssize_t len[lanes];                                                \
+        uint8_t block[bigname##_BLOCKBYTES];                                  \
+        Py_ssize_t i, j, count, node, offset;                                 \
+                                                                              \
+        if (P.key_length) {                                                   \
+            memset(block, 0, sizeof(block));                                  \
+            memcpy(block, L->key, P.key_length);                              \
+        }                                                                     \
+                                                                              \
+        for (i = (Py_ssize_t)start; i < (Py_ssize_t)end; i += count) {        \
+            count = (Py_ssize_t)end - i < lanes ? (Py_ssize_t)end - i : lanes;\
+            for (j = 0; j < count; j++) {                                     \
+                node = i + j;                                                 \
+                offset = node * L->node_size;                                 \
+                in[j] = L->in + offset;                                       \
+                len[j] = L->inlen - offset < L->node_size ?                   \
+                         L->inlen - offset : L->node_size;                    \
+                                                                              \
+                name##_set_node_offset(&P, (uint64_t)node);                   \
+                S[j] = &states[j];                                            \
+                name##_init_param(S[j], &P);                                  \
+                S[j]->last_node = (node == L->count - 1);                     \
+                if (P.key_length)                                             \
+                    name##_update(S[j], block, sizeof(block));                \
+            }                                                                 \
+            name##_hash_states(S, in, len, count,                             \
+                               L->out + i * P.digest_length,                  \
+                               P.digest_length);                              \
+        }                                                                     \
+                                                                              \
+        secure_zero_memory(states, sizeof(states));                           \
+        secure_zero_memory(block, sizeof(block));                             \
+    }
+
+
+/*
+ * Hash data as a tree level by level, spreading nodes of each level
+ * between threads. Returns 0 on success or -1 if out of memory.
+ */
+#define DECL_BLAKE2_HASH_TREE(name, bigname)                                  \
+    static int                                                                \
+    name##_hash_tree(const name##_param *param, const uint8_t *key,           \
+                     const uint8_t *data, Py_ssize_t datalen,                 \
+                     Py_ssize_t nleaves, unsigned int threads, uint8_t *out)  \
+    {                                                                         \
+        name##_tree_level L;                                                  \
+        uint8_t *bufs[2];                                                     \
+        Py_ssize_t fanout = param->fanout, sizes[2];                          \
+        int level, depth = param->depth;                                      \
+                                                                              \
+        /* Even levels go to bufs[0] and odd ones to bufs[1]; levels 0 and    \
+         * 1 have the most nodes of each. */                                  \
+        sizes[0] = nleaves * param->inner_length;                             \
+        sizes[1] = (fanout == 0 ? 1 : (nleaves + fanout - 1) / fanout) *      \
+                   param->inner_length;                                       \
+        bufs[0] = PyMem_New(uint8_t, sizes[0]);                               \
+        bufs[1] = PyMem_New(uint8_t, sizes[1]);                               \
+        if (bufs[0] == NULL || bufs[1] == NULL) {                             \
+            PyMem_Free(bufs[0]);                                              \
+            PyMem_Free(bufs[1]);                                              \
+            return -1;                                                        \
+        }                                                                     \
+                                                                              \
+        L.param = *param;                                                     \
+        L.key = key;                                                          \
+        L.in = data;                                                          \
+        L.inlen = datalen;                                                    \
+        L.node_size = load32(&param->leaf_length);                            \
+        L.count = nleaves;                                                    \
+                                                                              \
+        for (level = 0; level < depth; level++) {                             \
+            L.param.node_depth = (uint8_t)level;                              \
+            if (level == depth - 1) {                                         \
+                L.param.digest_length = param->digest_length;                 \
+                L.out = out;                                                  \
+            } else {                                                          \
+                L.param.digest_length = param->inner_length;                  \
+                L.out = bufs[level % 2];                                      \
+            }                                                                 \
+                                                                              \
+            pyblake2_parallel_for((size_t)L.count, threads,                   \
+                                  name##_hash_tree_nodes, &L);                \
+                                                                              \
+            /* Nodes of the next level hash digests of up to fanout nodes     \
+             * of this one (all of them with unlimited fanout). */            \
+            L.in = L.out;                                                     \
+            L.inlen = L.count * param->inner_length;                          \
+            if (fanout == 0) {                                                \
+                L.node_size = L.inlen;                                        \
+                L.count = 1;                                                  \
+            } else {                                                          \
+                L.node_size = fanout * param->inner_length;                   \
+                L.count = (L.count + fanout - 1) / fanout;                    \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        secure_zero_memory(&L.param, sizeof(L.param));                        \
+        secure_zero_memory(bufs[0], sizes[0]);                                \
+        secure_zero_memory(bufs[1], sizes[1]);                                \
+        PyMem_Free(bufs[0]);                                                  \
+        PyMem_Free(bufs[1]);                                                  \
+        return 0;                                                             \
+    }
+
+
+#define DECL_PY_BLAKE2_TREE(name, bigname)                                    \
+    static PyObject *                                                         \
+    py_##name##_tree(PyObject *self, PyObject *args, PyObject *kw)            \
+    {                                                                         \
+        PyObject *data_obj, *params, *key_obj, *result = NULL;                \
+        name##Object tmpl;                                                    \
+        Py_buffer data, key;                                                  \
+        unsigned PY_LONG_LONG leaf_size;                                      \
+        int fanout = 2, depth = 0, inner_size = bigname##_OUTBYTES;           \
+        int threads = 0, min_depth, ret;                                      \
+        Py_ssize_t nleaves, nodes;                                            \
+        char **name_p;                                                        \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+                                                                              \
+        data.buf = key.buf = NULL;                                            \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, "OK|iiii:" #name "_tree",    \
+                              tree_kwlist, &data_obj, &leaf_size, &fanout,    \
+                              &depth, &inner_size, &threads))                 \
+            return NULL;                                                      \
+                                                                              \
+        for (name_p = tree_reserved_kwlist; *name_p != NULL; name_p++) {      \
+            if (PyDict_GetItemString(params, *name_p) != NULL) {              \
+                PyErr_Format(PyExc_TypeError, "'%s' is an invalid keyword "   \
+                        "argument for " #name "_tree()", *name_p);            \
+                goto err0;                                                    \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        /* Validate digest_size, key, salt and person. */                     \
+        if (!init_##name##Template(&tmpl, params, #name "_tree", 0))          \
+            goto err0;                                                        \
+                                                                              \
+        if (leaf_size == 0 || leaf_size > 0xFFFFFFFFULL) {                    \
+            PyErr_SetString(PyExc_ValueError,                                 \
+                    "leaf_size must be between 1 and 2**32-1");               \
+            goto err0;                                                        \
+        }                                                                     \
+        if (fanout < 0 || fanout > 255) {                                     \
+            PyErr_SetString(PyExc_ValueError,                                 \
+                    "fanout must be between 0 and 255");                      \
+            goto err0;                                                        \
+        }                                                                     \
+        if (depth < 0 || depth > 255) {                                       \
+            PyErr_SetString(PyExc_ValueError,                                 \
+                    "depth must be between 0 and 255");                       \
+            goto err0;                                                        \
+        }                                                                     \
+        if (inner_size <= 0 || inner_size > bigname##_OUTBYTES) {             \
+            PyErr_Format(PyExc_ValueError,                                    \
+                    "inner_size must be between 1 and %d",                    \
+                    bigname##_OUTBYTES);                                      \
+            goto err0;                                                        \
+        }                                                                     \
+        if (threads < 0) {                                                    \
+            PyErr_SetString(PyExc_ValueError, "threads must not be negative");\
+            goto err0;                                                        \
+        }                                                                     \
+                                                                              \
+        if (!getbuffer(data_obj, &data))                                      \
+            goto err0;                                                        \
+                                                                              \
+        key_obj = PyDict_GetItemString(params, "key");                        \
+        if (tmpl.param.key_length > 0 && !getbuffer(key_obj, &key))           \
+            goto err0;                                                        \
+                                                                              \
+        /* Empty data is hashed by a single leaf. */                          \
+        nleaves = (Py_ssize_t)((data.len + leaf_size - 1) / leaf_size);       \
+        if (nleaves == 0)                                                     \
+            nleaves = 1;                                                      \
+                                                                              \
+        /* Find the smallest depth that fits all leaves. */                   \
+        min_depth = 1;                                                        \
+        for (nodes = nleaves; nodes > 1; min_depth++) {                       \
+            if (fanout == 1) {                                                \
+                PyErr_SetString(PyExc_ValueError,                             \
+                        "data doesn't fit in one leaf with fanout 1");        \
+                goto err0;                                                    \
+            }                                                                 \
+            nodes = fanout == 0 ? 1 : (nodes + fanout - 1) / fanout;          \
+        }                                                                     \
+        if (depth == 0) {                                                     \
+            depth = min_depth;                                                \
+        } else if (depth < min_depth) {                                       \
+            PyErr_Format(PyExc_ValueError,                                    \
+                    "data doesn't fit in a tree of depth %d", depth);         \
+            goto err0;                                                        \
+        }                                                                     \
+        if (depth > 255) {                                                    \
+            PyErr_SetString(PyExc_ValueError, "tree is too deep");            \
+            goto err0;                                                        \
+        }                                                                     \
+        if (nleaves > PY_SSIZE_T_MAX / inner_size) {                          \
+            PyErr_NoMemory();                                                 \
+            goto err0;                                                        \
+        }                                                                     \
+                                                                              \
+        tmpl.param.fanout = (uint8_t)fanout;                                  \
+        tmpl.param.depth = (uint8_t)depth;                                    \
+        store32(&tmpl.param.leaf_length, (uint32_t)leaf_size);                \
+        tmpl.param.inner_length = (uint8_t)inner_size;                        \
+                                                                              \
+        if (threads == 0)                                                     \
+            threads = pyblake2_cpu_count();                                   \
+                                                                              \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        ret = name##_hash_tree(&tmpl.param, (const uint8_t *)key.buf,         \
+                               (const uint8_t *)data.buf, data.len, nleaves,  \
+                               (unsigned int)threads, digest);                \
+        Py_END_ALLOW_THREADS                                                  \
+                                                                              \
+        if (ret < 0) {                                                        \
+            PyErr_NoMemory();                                                 \
+            goto err0;                                                        \
+        }                                                                     \
+        result = COMPAT_PYBYTES_FROM_STRING_AND_SIZE((const char *)digest,    \
+                tmpl.param.digest_length);                                    \
+                                                                              \
+    err0:                                                                     \
+        if (data.buf != NULL)                                                 \
+            PyBuffer_Release(&data);                                          \
+        if (key.buf != NULL)                                                  \
+            PyBuffer_Release(&key);                                           \
+        Py_DECREF(params);                                                    \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        secure_zero_memory(digest, sizeof(digest));                           \
+        return result;                                                        \
+    }
+
+#define DECL_BLAKE2_TREE(name, bigname, lanes)          \
+    DECL_BLAKE2_TREE_STRUCT(name)                       \
+    DECL_BLAKE2_HASH_TREE_NODES(name, bigname, lanes)   \
+    DECL_BLAKE2_HASH_TREE(name, bigname)                \
+    DECL_PY_BLAKE2_TREE(name, bigname)
+
+
+/*
+ * File hashing.
+ */
+
+static char *file_kwlist[] = { "file", "queue_depth", "mmap", NULL };
+
+/* Reads kept in flight by queued file reads; each needs a 1 MiB buffer. */
+#define MAX_QUEUE_DEPTH 256
+
+static int
+check_queue_depth(int queue_depth)
+{
+    if (queue_depth < 0 || queue_depth > MAX_QUEUE_DEPTH) {
+        PyErr_Format(PyExc_ValueError,
+                     "queue_depth must be between 0 and %d", MAX_QUEUE_DEPTH);
+        return 0;
+    }
+    return 1;
+}
+
+#define DECL_PY_BLAKE2_FILE(name, bigname)                                    \
+    static PyObject *                                                         \
+    py_##name##_file(PyObject *self, PyObject *args, PyObject *kw)            \
+    {                                                                         \
+        PyObject *file, *params, *result = NULL, *mmap_obj = NULL;            \
+        name##Object tmpl;                                                    \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+        int fd, owned, err, queue_depth = 0, use_mmap;                        \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, "O|iO:" #name "_file",       \
+                              file_kwlist, &file, &queue_depth, &mmap_obj))   \
+            return NULL;                                                      \
+        use_mmap = (mmap_obj != NULL && PyObject_IsTrue(mmap_obj));           \
+                                                                              \
+        if (!check_queue_depth(queue_depth) ||                                \
+                !init_##name##Template(&tmpl, params, #name "_file", 0))      \
+            goto err0;                                                        \
+                                                                              \
+        if ((fd = open_file_arg(file, &owned)) < 0)                           \
+            goto err0;                                                        \
+                                                                              \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        err = pyblake2_read_file(fd, (unsigned int)queue_depth, use_mmap,     \
+                                 name##_update_data, &tmpl.state);            \
+        if (owned)                                                            \
+            pyblake2_close_file(fd);                                          \
+        if (err == 0 &&                                                       \
+                name##_final(&tmpl.state, digest,                             \
+                             tmpl.param.digest_length) != 0)                  \
+            err = -1;                                                         \
+        Py_END_ALLOW_THREADS                                                  \
+                                                                              \
+        if (err == -1) {                                                      \
+            final_error();                                                    \
+            goto err0;                                                        \
+        }                                                                     \
+        if (err != 0) {                                                       \
+            errno = err;                                                      \
+            PyErr_SetFromErrno(COMPAT_PYEXC_IO_ERROR);                        \
+            goto err0;                                                        \
+        }                                                                     \
+        result = COMPAT_PYBYTES_FROM_STRING_AND_SIZE((const char *)digest,    \
+                tmpl.param.digest_length);                                    \
+                                                                              \
+    err0:                                                                     \
+        Py_DECREF(params);                                                    \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        return result;                                                        \
+    }
+
+
+/*
+ * Files are hashed by native threads, each of which opens and reads its
+ * files and hashes them starting from a copy of the template state with the
+ * key block absorbed. Nothing is buffered after reading an empty file, which
+ * is hashed from the template state instead. As in hash_states(), the
+ * copies can be finalized without checking.
+ */
+#define DECL_BLAKE2_HASH_FILES(name, bigname)                                 \
+    typedef struct {                                                          \
+        const name##Object *tmpl;                                             \
+        const name##_state *absorbed;                                         \
+        const char **paths;                                                   \
+        uint8_t *digests;                                                     \
+        int *errors;                                                          \
+        unsigned int queue_depth;                                             \
+        int use_mmap;                                                         \
+    } name##_files_job;                                                       \
+                                                                              \
+    static void                                                               \
+    name##_hash_files_range(void *arg, size_t start, size_t end)              \
+    {                                                                         \
+        name##_files_job *job = (name##_files_job *)arg;                      \
+        uint8_t outlen = job->tmpl->param.digest_length;                      \
+        name##_state state;                                                   \
+        size_t i;                                                             \
+        int fd;                                                               \
+                                                                              \
+        for (i = start; i < end; i++) {                                       \
+            if ((fd = pyblake2_open_file(job->paths[i])) < 0) {               \
+                job->errors[i] = errno;                                       \
+                continue;                                                     \
+            }                                                                 \
+            state = *job->absorbed;                                           \
+            job->errors[i] = pyblake2_read_file(fd, job->queue_depth,         \
+                                                job->use_mmap,                \
+                                                name##_update_data, &state);  \
+            pyblake2_close_file(fd);                                          \
+            if (job->errors[i] != 0)                                          \
+                continue;                                                     \
+            if (state.buflen == 0)                                            \
+                state = job->tmpl->state;                                     \
+            name##_final(&state, job->digests + i * outlen, outlen);          \
+        }                                                                     \
+        secure_zero_memory(&state, sizeof(state));                            \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    name##_hash_files(PyObject *paths, PyObject *params, int threads,         \
+                      int queue_depth, int use_mmap)                          \
+    {                                                                         \
+        PyObject *seq, **encoded = NULL, *result = NULL, *digest;             \
+        name##Object tmpl;                                                    \
+        name##_state absorbed;                                                \
+        name##_files_job job;                                                 \
+        Py_ssize_t n, i;                                                      \
+        uint8_t outlen;                                                       \
+                                                                              \
+        job.paths = NULL;                                                     \
+        job.digests = NULL;                                                   \
+        job.errors = NULL;                                                    \
+                                                                              \
+        if (!init_##name##Template(&tmpl, params, "hash_files", 0))           \
+            return NULL;                                                      \
+        name##_absorb_key(&absorbed, &tmpl.state);                            \
+        outlen = tmpl.param.digest_length;                                    \
+                                                                              \
+        if ((seq = PySequence_Fast(paths, "paths must be iterable")) == NULL) \
+            goto err0;                                                        \
+        n = PySequence_Fast_GET_SIZE(seq);                                    \
+                                                                              \
+        if (n > PY_SSIZE_T_MAX / bigname##_OUTBYTES)                          \
+            goto nomem;                                                       \
+        encoded = (PyObject **)PyMem_Malloc((n + 1) * sizeof(PyObject *));    \
+        job.paths = (const char **)PyMem_Malloc((n + 1) * sizeof(char *));    \
+        job.digests = (uint8_t *)PyMem_Malloc(n * outlen + 1);                \
+        job.errors = (int *)PyMem_Malloc((n + 1) * sizeof(int));              \
+        if (encoded == NULL || job.paths == NULL || job.digests == NULL ||    \
+                job.errors == NULL)                                           \
+            goto nomem;                                                       \
+                                                                              \
+        for (i = 0; i < n; i++) {                                             \
+            encoded[i] = encode_path(PySequence_Fast_GET_ITEM(seq, i));       \
+            if (encoded[i] == NULL) {                                         \
+                n = i;                                                        \
+                goto done;                                                    \
+            }                                                                 \
+            job.paths[i] = PyBytes_AS_STRING(encoded[i]);                     \
+            job.errors[i] = 0;                                                \
+        }                                                                     \
+                                                                              \
+        if (threads == 0)                                                     \
+            threads = pyblake2_cpu_count();                                   \
+        job.tmpl = &tmpl;                                                     \
+        job.absorbed = &absorbed;                                             \
+        job.queue_depth = (unsigned int)queue_depth;                          \
+        job.use_mmap = use_mmap;                                              \
+                                                                              \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        pyblake2_parallel_for(n, (unsigned int)threads,                       \
+                              name##_hash_files_range, &job);                 \
+        Py_END_ALLOW_THREADS                                                  \
+                                                                              \
+        /* Report the first file that couldn't be hashed. */                  \
+        for (i = 0; i < n; i++) {                                             \
+            if (job.errors[i] != 0) {                                         \
+                errno = job.errors[i];                                        \
+                PyErr_SetFromErrnoWithFilenameObject(COMPAT_PYEXC_IO_ERROR,   \
+                        PySequence_Fast_GET_ITEM(seq, i));                    \
+                goto done;                                                    \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        if ((result = PyList_New(n)) == NULL)                                 \
+            goto done;                                                        \
+        for (i = 0; i < n; i++) {                                             \
+            digest = COMPAT_PYBYTES_FROM_STRING_AND_SIZE(                     \
+                    (const char *)job.digests + i * outlen, outlen);          \
+            if (digest == NULL) {                                             \
+                Py_CLEAR(result);                                             \
+                goto done;                                                    \
+            }                                                                 \
+            PyList_SET_ITEM(result, i, digest);                               \
+        }                                                                     \
+                                                                              \
+    done:                                                                     \
+        for (i = 0; i < n; i++)                                               \
+            Py_DECREF(encoded[i]);                                            \
+        Py_DECREF(seq);                                                       \
+    err0:                                                                     \
+        PyMem_Free(encoded);                                                  \
+        PyMem_Free((void *)job.paths);                                        \
+        PyMem_Free(job.digests);                                              \
+        PyMem_Free(job.errors);                                               \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        secure_zero_memory(&absorbed, sizeof(absorbed));                      \
+        return result;                                                        \
+                                                                              \
+    nomem:                                                                    \
+        PyErr_NoMemory();                                                     \
+        n = 0;                                                                \
+        goto done;                                                            \
+    }
+
+/*
+ * Hashing of append-only files, such as logs, with checkpoints: the state
+ * after every interval bytes is appended to an index file, so that later
+ * calls only hash the data after the last checkpoint within the file. The
+ * index starts with a header identifying the hash function, the interval
+ * and the parameters and key, by a fingerprint that doesn't reveal the key;
+ * an index with another header is rebuilt.
+ */
+
+static char *log_kwlist[] = { "file", "index", "interval", NULL };
+
+#define LOG_INDEX_MAGIC "pyb2log\n"
+#define LOG_INDEX_MAGIC_SIZE 8
+
+#define LOG_HEADER_SIZE(strname, bigname)                       \
+    (LOG_INDEX_MAGIC_SIZE + STATE_HEADER_SIZE(strname) + 8 +    \
+     bigname##_OUTBYTES)
+
+/* Default distance of checkpoints. */
+#define LOG_INTERVAL ((uint64_t)1 << 26)
+
+/* Bytes collected without the GIL; err is set if memory runs out. */
+typedef struct {
+    uint8_t *data;
+    size_t len, size;
+    int err;
+} byte_buffer;
+
+static void
+append_bytes(void *arg, const uint8_t *data, size_t len)
+{
+    byte_buffer *buf = (byte_buffer *)arg;
+    uint8_t *p;
+    size_t size;
+
+    if (buf->err != 0)
+        return;
+    if (len > buf->size - buf->len) {
+        size = buf->len + len;
+        if (size < 2 * buf->size)
+            size = 2 * buf->size;
+        if ((p = (uint8_t *)realloc(buf->data, size)) == NULL) {
+            buf->err = ENOMEM;
+            return;
+        }
+        buf->data = p;
+        buf->size = size;
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+}
+
+static void
+free_byte_buffer(byte_buffer *buf)
+{
+    if (buf->data != NULL) {
+        secure_zero_memory(buf->data, buf->len);
+        free(buf->data);
+    }
+}
+
+#define DECL_BLAKE2_LOG(name, bigname)                                        \
+    typedef struct {                                                          \
+        name##_state state;                                                   \
+        uint64_t pos, interval;                                               \
+        byte_buffer records;    /* checkpoints made by this call */           \
+    } name##_log_job;                                                         \
+                                                                              \
+    /*                                                                        \
+     * Unkeyed hash of the parameter block, last node flag and key. Its       \
+     * fresh state and full output length can't make final() fail.            \
+     */                                                                       \
+    static void                                                               \
+    name##_log_fingerprint(const name##Object *tmpl, uint8_t *out)            \
+    {                                                                         \
+        name##_state S;                                                       \
+                                                                              \
+        name##_init(&S, bigname##_OUTBYTES);                                  \
+        name##_update(&S, (const uint8_t *)&tmpl->param,                      \
+                      sizeof(tmpl->param));                                   \
+        name##_update(&S, &tmpl->state.last_node, 1);                         \
+        if (tmpl->key != NULL)                                                \
+            name##_update(&S, tmpl->key->data, tmpl->key->len);               \
+        name##_final(&S, out, bigname##_OUTBYTES);                            \
+        secure_zero_memory(&S, sizeof(S));                                    \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    name##_log_data(void *arg, const uint8_t *data, size_t len)               \
+    {                                                                         \
+        name##_log_job *job = (name##_log_job *)arg;                          \
+        uint8_t record[STATE_SIZE(bigname)];                                  \
+        uint64_t n;                                                           \
+                                                                              \
+        while (len > 0) {                                                     \
+            n = job->interval - job->pos % job->interval;                     \
+            if (n > len)                                                      \
+                n = len;                                                      \
+            name##_update(&job->state, data, n);                              \
+            job->pos += n;                                                    \
+            data += n;                                                        \
+            len -= (size_t)n;                                                 \
+            if (job->pos % job->interval == 0) {                              \
+                name##_pack_state(record, &job->state);                       \
+                append_bytes(&job->records, record, sizeof(record));          \
+                secure_zero_memory(record, sizeof(record));                   \
+            }                                                                 \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    /*                                                                        \
+     * Resume from the last usable checkpoint in the index at index_path      \
+     * (missing if index_fd is negative), hash the rest of the file and       \
+     * replace the index if it changed. Returns 0 or an errno value, and      \
+     * sets *index_failed if the error is about the index.                    \
+     */                                                                       \
+    static int                                                                \
+    name##_hash_log(int fd, int index_fd, const char *index_path,             \
+                    const uint8_t *header, size_t header_size,                \
+                    name##_log_job *job, int *index_failed)                   \
+    {                                                                         \
+        byte_buffer index = { NULL, 0, 0, 0 };                                \
+        uint64_t size, stored = 0, count;                                     \
+        name##_state resumed;                                                 \
+        int err = 0, header_ok;                                               \
+                                                                              \
+        *index_failed = 1;                                                    \
+        if (index_fd >= 0)                                                    \
+            err = pyblake2_read_file(index_fd, 0, 0, append_bytes, &index);   \
+        if (err != 0 || (err = index.err) != 0)                               \
+            goto done;                                                        \
+        header_ok = (index.len >= header_size &&                              \
+                     memcmp(index.data, header, header_size) == 0);           \
+        if (header_ok)                                                        \
+            stored = (index.len - header_size) / STATE_SIZE(bigname);         \
+                                                                              \
+        /* Checkpoints past the end of the file are dropped. */               \
+        *index_failed = 0;                                                    \
+        if ((err = pyblake2_file_size(fd, &size)) != 0)                       \
+            goto done;                                                        \
+        count = (stored < size / job->interval) ? stored                      \
+                                                : size / job->interval;       \
+        if (count > 0) {                                                      \
+            if (name##_unpack_state(index.data + header_size +                \
+                        (size_t)(count - 1) * STATE_SIZE(bigname),            \
+                        &resumed) != NULL)                                    \
+                job->state = resumed;                                         \
+            else                                                              \
+                count = 0;                                                    \
+            secure_zero_memory(&resumed, sizeof(resumed));                    \
+        }                                                                     \
+        job->pos = count * job->interval;                                     \
+                                                                              \
+        err = pyblake2_read_file_from(fd, job->pos, name##_log_data, job);    \
+        if (err != 0 || (err = job->records.err) != 0)                        \
+            goto done;                                                        \
+                                                                              \
+        /* New index: the header, checkpoints kept and checkpoints made. */   \
+        *index_failed = 1;                                                    \
+        if (header_ok && count == stored && job->records.len == 0)            \
+            goto done;                                                        \
+        if (header_ok) {                                                      \
+            index.len = header_size + (size_t)count * STATE_SIZE(bigname);    \
+        } else {                                                              \
+            index.len = 0;                                                    \
+            append_bytes(&index, header, header_size);                        \
+        }                                                                     \
+        append_bytes(&index, job->records.data, job->records.len);            \
+        if ((err = index.err) == 0)                                           \
+            err = pyblake2_replace_file(index_path, index.data, index.len);   \
+                                                                              \
+    done:                                                                     \
+        free_byte_buffer(&index);                                             \
+        return err;                                                           \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_log(PyObject *self, PyObject *args, PyObject *kw)             \
+    {                                                                         \
+        PyObject *file, *index, *params, *index_path = NULL, *result = NULL;  \
+        unsigned PY_LONG_LONG interval = LOG_INTERVAL;                        \
+        uint8_t header[LOG_HEADER_SIZE(#name, bigname)], *p;                  \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+        name##Object tmpl;                                                    \
+        name##_log_job job;                                                   \
+        int fd, index_fd, owned, index_failed, err;                           \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, "OO|K:" #name "_log",        \
+                              log_kwlist, &file, &index, &interval))          \
+            return NULL;                                                      \
+                                                                              \
+        job.records.data = NULL;                                              \
+        job.records.len = job.records.size = 0;                               \
+        job.records.err = 0;                                                  \
+        tmpl.key = NULL;                                                      \
+        if (interval == 0) {                                                  \
+            PyErr_SetString(PyExc_ValueError, "interval must be positive");   \
+            goto err0;                                                        \
+        }                                                                     \
+        if (!init_##name##Template(&tmpl, params, #name "_log", 1))           \
+            goto err0;                                                        \
+        if ((index_path = encode_path(index)) == NULL)                        \
+            goto err0;                                                        \
+        if ((fd = open_file_arg(file, &owned)) < 0)                           \
+            goto err0;                                                        \
+                                                                              \
+        memcpy(header, LOG_INDEX_MAGIC, LOG_INDEX_MAGIC_SIZE);                \
+        p = pack_state_header(header + LOG_INDEX_MAGIC_SIZE, #name);          \
+        store64(p, interval);                                                 \
+        name##_log_fingerprint(&tmpl, p + 8);                                 \
+        job.state = tmpl.state;                                               \
+        job.interval = interval;                                              \
+        job.pos = 0;                                                          \
+                                                                              \
+        Py_BEGIN_ALLOW_THREADS                                                \
+        index_fd = pyblake2_open_file(PyBytes_AS_STRING(index_path));         \
+        if (index_fd < 0 && errno != ENOENT) {                                \
+            err = errno;                                                      \
+            index_failed = 1;                                                 \
+        } else {                                                              \
+            err = name##_hash_log(fd, index_fd,                               \
+                                  PyBytes_AS_STRING(index_path), header,      \
+                                  sizeof(header), &job, &index_failed);       \
+            if (index_fd >= 0)                                                \
+                pyblake2_close_file(index_fd);                                \
+        }                                                                     \
+        if (owned)                                                            \
+            pyblake2_close_file(fd);                                          \
+        if (err == 0 &&                                                       \
+                name##_final(&job.state, digest,                              \
+                             tmpl.param.digest_length) != 0)                  \
+            err = -1;                                                         \
+        Py_END_ALLOW_THREADS                                                  \
+                                                                              \
+        if (err == -1) {                                                      \
+            final_error();                                                    \
+        } else if (err == ENOMEM) {                                           \
+            PyErr_NoMemory();                                                 \
+        } else if (err != 0) {                                                \
+            errno = err;                                                      \
+            if (index_failed)                                                 \
+                PyErr_SetFromErrnoWithFilenameObject(COMPAT_PYEXC_IO_ERROR,   \
+                                                     index);                  \
+            else                                                              \
+                PyErr_SetFromErrno(COMPAT_PYEXC_IO_ERROR);                    \
+        } else {                                                              \
+            result = Py_BuildValue("NK",                                      \
+                    COMPAT_PYBYTES_FROM_STRING_AND_SIZE(                      \
+                            (const char *)digest, tmpl.param.digest_length),  \
+                    (unsigned PY_LONG_LONG)job.pos);                          \
+        }                                                                     \
+                                                                              \
+    err0:                                                                     \
+        Py_XDECREF(index_path);                                               \
+        Py_DECREF(params);                                                    \
+        secure_zero_memory(header, sizeof(header));                           \
+        key_decref(tmpl.key);                                                 \
+        secure_zero_memory(&tmpl.param, sizeof(tmpl.param));                  \
+        secure_zero_memory(&tmpl.state, sizeof(tmpl.state));                  \
+        secure_zero_memory(&job.state, sizeof(job.state));                    \
+        free_byte_buffer(&job.records);                                       \
+        return result;                                                        \
+    }
+
+#define DECL_BLAKE2_FILE(name, bigname)             \
+    DECL_PY_BLAKE2_FILE(name, bigname)              \
+    DECL_BLAKE2_HASH_FILES(name, bigname)           \
+    DECL_BLAKE2_LOG(name, bigname)
+
+
+/*
+ * Prepared templates: hash objects without data, which are copied to start
+ * hashing each message, so that parameters are parsed and the key block is
+ * compressed once.
+ */
+
+static char *template_kwlist[] = { "data", NULL };
+
+/*
+ * Templates also keep the state with the key block absorbed, which
+ * non-empty messages start from.
+ */
+#define DECL_BLAKE2_TEMPLATE_STRUCT(name)   \
+    typedef struct {                        \
+        name##Object    obj;                \
+        name##_state    absorbed;           \
+    } name##Template;
+
+
+#define DECL_PY_BLAKE2_TEMPLATE_NEW(name)                                     \
+    PyDoc_STRVAR(py_##name##_template_new__doc__,                             \
+    "Return a new hash object with the prepared parameters and key,\n"        \
+    "updated with data if given.");                                           \
+                                                                              \
+    static PyObject *                                                         \
+    name##_template_new(name##Template *self, PyObject *data)                 \
+    {                                                                         \
+        name##Object *obj;                                                    \
+        Py_buffer buf;                                                        \
+                                                                              \
+        if ((obj = new_##name##Object()) == NULL)                             \
+            return NULL;                                                      \
+                                                                              \
+        obj->param = self->obj.param;                                         \
+        obj->state = self->obj.state;                                         \
+        obj->key = key_incref(self->obj.key);                                 \
+                                                                              \
+        if (data != NULL) {                                                   \
+            if (!getbuffer(data, &buf)) {                                     \
+                Py_DECREF(obj);                                               \
+                return NULL;                                                  \
+            }                                                                 \
+                                                                              \
+            if (buf.len > 0)                                                  \
+                obj->state = self->absorbed;                                  \
+            if (buf.len >= GIL_MINSIZE) {                                     \
+                Py_BEGIN_ALLOW_THREADS                                        \
+                name##_update_nogil(&obj->state, buf.buf, buf.len);           \
+                Py_END_ALLOW_THREADS                                          \
+            } else {                                                          \
+                name##_update(&obj->state, buf.buf, buf.len);                 \
+            }                                                                 \
+            PyBuffer_Release(&buf);                                           \
+        }                                                                     \
+                                                                              \
+        return (PyObject *)obj;                                               \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_template_new(name##Template *self, PyObject *args,            \
+                             PyObject *kw)                                    \
+    {                                                                         \
+        PyObject *data = NULL;                                                \
+                                                                              \
+        if (!PyArg_ParseTupleAndKeywords(args, kw, "|O:new",                  \
+                                         template_kwlist, &data))             \
+            return NULL;                                                      \
+                                                                              \
+        return name##_template_new(self, data);                               \
+    }
+
+
+#define DECL_PY_BLAKE2_TEMPLATE_MAC(name, bigname)                            \
+    PyDoc_STRVAR(py_##name##_template_mac__doc__,                             \
+    "Return the digest of data with the prepared parameters and key.");       \
+                                                                              \
+    static PyObject *                                                         \
+    name##_template_mac(name##Template *self, PyObject *data)                 \
+    {                                                                         \
+        uint8_t digest[bigname##_OUTBYTES];                                   \
+        name##_state state;                                                   \
+        Py_buffer buf;                                                        \
+        uint8_t outlen;                                                       \
+        int err;                                                              \
+                                                                              \
+        if (!getbuffer(data, &buf))                                           \
+            return NULL;                                                      \
+                                                                              \
+        state = buf.len > 0 ? self->absorbed : self->obj.state;               \
+        outlen = self->obj.param.digest_length;                               \
+        if (buf.len >= GIL_MINSIZE) {                                         \
+            Py_BEGIN_ALLOW_THREADS                                            \
+            name##_update_nogil(&state, buf.buf, buf.len);                    \
+            err = name##_final(&state, digest, outlen);                       \
+            Py_END_ALLOW_THREADS                                              \
+        } else {                                                              \
+            name##_update(&state, buf.buf, buf.len);                          \
+            err = name##_final(&state, digest, outlen);                       \
+        }                                                                     \
+        PyBuffer_Release(&buf);                                               \
+        secure_zero_memory(&state, sizeof(state));                            \
+        if (err != 0)                                                         \
+            return final_error();                                             \
+                                                                              \
+        return COMPAT_PYBYTES_FROM_STRING_AND_SIZE((const char *)digest,      \
+                                                   outlen);                   \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_template_mac(name##Template *self, PyObject *args,            \
+                             PyObject *kw)                                    \
+    {                                                                         \
+        PyObject *data;                                                       \
+                                                                              \
+        if (!PyArg_ParseTupleAndKeywords(args, kw, "O:mac",                   \
+                                         template_kwlist, &data))             \
+            return NULL;                                                      \
+                                                                              \
+        return name##_template_mac(self, data);                               \
+    }
+
+
+/* Methods of templates called with positional data only skip building
+ * and parsing argument tuples. */
+#ifdef HAVE_FASTCALL
+# define DECL_PY_BLAKE2_TEMPLATE_FAST(name)                                   \
+    static PyObject *                                                         \
+    py_##name##_template_new_fast(name##Template *self,                       \
+                                  PyObject *const *args, Py_ssize_t nargs,    \
+                                  PyObject *kwnames)                          \
+    {                                                                         \
+        if (nargs <= 1 &&                                                     \
+                (kwnames == NULL || PyTuple_GET_SIZE(kwnames) == 0))          \
+            return name##_template_new(self, nargs > 0 ? args[0] : NULL);     \
+        return call_with_args((PyObject *)self, args, nargs, kwnames,         \
+                              (varargs_func)py_##name##_template_new);        \
+    }                                                                         \
+                                                                              \
+    static PyObject *                                                         \
+    py_##name##_template_mac_fast(name##Template *self,                       \
+                                  PyObject *const *args, Py_ssize_t nargs,    \
+                                  PyObject *kwnames)                          \
+    {                                                                         \
+        if (nargs == 1 &&                                                     \
+                (kwnames == NULL || PyTuple_GET_SIZE(kwnames) == 0))          \
+            return name##_template_mac(self, args[0]);                        \
+        return call_with_args((PyObject *)self, args, nargs, kwnames,         \
+                              (varargs_func)py_##name##_template_mac);        \
+    }
+#else
+# define DECL_PY_BLAKE2_TEMPLATE_FAST(name)
+#endif
+
+
+#define DECL_PY_BLAKE2_TEMPLATE_METHODS(name)                                 \
+    static PyMethodDef name##_template_methods[] = {                          \
+        {"new", FASTCALL_METHOD(py_##name##_template_new),                    \
+            py_##name##_template_new__doc__},                                 \
+        {"mac", FASTCALL_METHOD(py_##name##_template_mac),                    \
+            py_##name##_template_mac__doc__},                                 \
+        {NULL, NULL}                                                          \
+    };
+
+
+/* Templates are larger than hash objects, so they aren't kept in the free
+ * list. */
+#define DECL_PY_BLAKE2_TEMPLATE_DEALLOC(name)                           \
+    static void                                                         \
+    py_##name##_template_dealloc(PyObject *self)                        \
+    {                                                                   \
+        name##Template *tmpl = (name##Template *)self;                  \
+                                                                        \
+        secure_zero_memory(&tmpl->obj.param, sizeof(tmpl->obj.param));  \
+        secure_zero_memory(&tmpl->obj.state, sizeof(tmpl->obj.state));  \
+        secure_zero_memory(&tmpl->absorbed, sizeof(tmpl->absorbed));    \
+        key_decref(tmpl->obj.key);                                      \
+        FREE_LOCK(&tmpl->obj);                                          \
+        PyObject_Del(self);                                             \
+    }
+
+
+#define DECL_PY_BLAKE2_TEMPLATE_TYPE_OBJECT(name)                   \
+    static PyTypeObject name##TemplateType = {                      \
+        PyVarObject_HEAD_INIT(NULL, 0)                              \
+        "pyblake2." #name "_template", /* tp_name            */     \
+        sizeof(name##Template),   /* tp_size            */          \
+        0,                        /* tp_itemsize        */          \
+        py_##name##_template_dealloc, /* tp_dealloc     */          \
+        0,                        /* tp_print           */          \
+        0,                        /* tp_getattr         */          \
+        0,                        /* tp_setattr         */          \
+        0,                        /* tp_compare         */          \
+        0,                        /* tp_repr            */          \
+        0,                        /* tp_as_number       */          \
+        0,                        /* tp_as_sequence     */          \
+        0,                        /* tp_as_mapping      */          \
+        0,                        /* tp_hash            */          \
+        0,                        /* tp_call            */          \
+        0,                        /* tp_str             */          \
+        0,                        /* tp_getattro        */          \
+        0,                        /* tp_setattro        */          \
+        0,                        /* tp_as_buffer       */          \
+        Py_TPFLAGS_DEFAULT,       /* tp_flags           */          \
+        0,                        /* tp_doc             */          \
+        0,                        /* tp_traverse        */          \
+        0,                        /* tp_clear           */          \
+        0,                        /* tp_richcompare     */          \
+        0,                        /* tp_weaklistoffset  */          \
+        0,                        /* tp_iter            */          \
+        0,                        /* tp_iternext        */          \
+        name##_template_methods,  /* tp_methods         */          \
+        0,                        /* tp_members         */          \
+        name##_getsetters,        /* tp_getset          */          \
+    };
+
+
+static char *prepare_kwlist[] = { NULL };
+
+#define DECL_PY_BLAKE2_PREPARE(name)                                          \
+    static PyObject *                                                         \
+    py_##name##_prepare(PyObject *self, PyObject *args, PyObject *kw)         \
+    {                                                                         \
+        name##Template *tmpl;                                                 \
+        PyObject *params;                                                     \
+                                                                              \
+        if (!parse_batch_args(args, kw, &params, ":" #name "_prepare",        \
+                              prepare_kwlist))                                \
+            return NULL;                                                      \
+                                                                              \
+        tmpl = PyObject_New(name##Template, &name##TemplateType);             \
+        if (tmpl != NULL) {                                                   \
+            tmpl->obj.finalized = 0;                                          \
+            tmpl->obj.key = NULL;                                             \
+            INIT_LOCK(&tmpl->obj);                                            \
+            if (init_##name##Template(&tmpl->obj, params, #name "_prepare",   \
+                                      1))                                     \
+                name##_absorb_key(&tmpl->absorbed, &tmpl->obj.state);         \
+            else                                                              \
+                Py_CLEAR(tmpl);                                               \
+        }                                                                     \
+                                                                              \
+        Py_DECREF(params);                                                    \
+        return (PyObject *)tmpl;                                              \
+    }
+
+#define DECL_BLAKE2_TEMPLATE(name, bigname)         \
+    DECL_BLAKE2_TEMPLATE_STRUCT(name)               \
+    DECL_PY_BLAKE2_TEMPLATE_NEW(name)               \
+    DECL_PY_BLAKE2_TEMPLATE_MAC(name, bigname)      \
+    DECL_PY_BLAKE2_TEMPLATE_FAST(name)              \
+    DECL_PY_BLAKE2_TEMPLATE_METHODS(name)           \
+    DECL_PY_BLAKE2_TEMPLATE_DEALLOC(name)           \
+    DECL_PY_BLAKE2_TEMPLATE_TYPE_OBJECT(name)       \
+    DECL_PY_BLAKE2_PREPARE(name)
+
+/*
+ * Declare objects.
+ * Note: don't forget to update module init function and constants.
+ */
+
+PyDoc_STRVAR(py_blake2b_new__doc__,
+"blake2b(data=b'', digest_size=64, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> blake2b object\n"
+"\n"
+"Return a new BLAKE2b hash object.");
+
+DECL_BLAKE2_WRAPPER(blake2b, BLAKE2B)
+
+
+PyDoc_STRVAR(py_blake2b_oneshot__doc__,
+"blake2b_digest(data=b'', digest_size=64, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> digest\n"
+"\n"
+"Return the BLAKE2b digest of data, like blake2b(data, ...).digest()\n"
+"without creating a hash object.");
+
+DECL_PY_BLAKE2_ONESHOT(blake2b, BLAKE2B)
+
+
+PyDoc_STRVAR(py_blake2s_new__doc__,
+"blake2s(data=b'', digest_size=32, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> blake2s object\n"
+"\n"
+"Return a new BLAKE2s hash object.");
+
+DECL_BLAKE2_WRAPPER(blake2s, BLAKE2S)
+
+
+PyDoc_STRVAR(py_blake2s_oneshot__doc__,
+"blake2s_digest(data=b'', digest_size=32, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> digest\n"
+"\n"
+"Return the BLAKE2s digest of data, like blake2s(data, ...).digest()\n"
+"without creating a hash object.");
+
+DECL_PY_BLAKE2_ONESHOT(blake2s, BLAKE2S)
+
+
+PyDoc_STRVAR(py_blake2b_many__doc__,
+"blake2b_many(iterable, digest_size=64, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> list of digests\n"
+"\n"
+"Return BLAKE2b digests of each buffer from iterable, all computed with\n"
+"the same parameters.");
+
+PyDoc_STRVAR(py_blake2b_chunks__doc__,
+"blake2b_chunks(data, chunk_size, out=None, digest_size=64, key=b'', ...) "
+"-> digests\n"
+"\n"
+"Split data into chunk_size-byte chunks (the last one may be shorter) and\n"
+"return their BLAKE2b digests concatenated, written to out if given.\n"
+"Accepts the same hash parameters as blake2b().");
+
+DECL_BLAKE2_BATCH(blake2b, BLAKE2B, 8)
+
+
+PyDoc_STRVAR(py_blake2b_tree__doc__,
+"blake2b_tree(data, leaf_size, fanout=2, depth=0, inner_size=64, threads=0, "
+"digest_size=64, key=b'', salt=b'', person=b'') -> digest\n"
+"\n"
+"Return the BLAKE2b tree hash digest of data split into leaf_size-byte\n"
+"leaves, hashing nodes of each level on threads native threads (0 means\n"
+"the number of CPUs). Depth 0 means the smallest depth that fits data.");
+
+DECL_BLAKE2_TREE(blake2b, BLAKE2B, 8)
+
+
+PyDoc_STRVAR(py_blake2b_prepare__doc__,
+"blake2b_prepare(digest_size=64, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> blake2b_template object\n"
+"\n"
+"Return a template for BLAKE2B hashes with the given parameters and key.\n"
+"Parameters are parsed and the key block is compressed once; the new()\n"
+"method returns hash objects, and mac() returns digests.");
+
+DECL_BLAKE2_TEMPLATE(blake2b, BLAKE2B)
+
+
+PyDoc_STRVAR(py_blake2b_file__doc__,
+"blake2b_file(file, queue_depth=0, mmap=False, digest_size=64, key=b'', "
+"salt=b'', person=b'', fanout=1, depth=1, leaf_size=0, node_offset=0, "
+"node_depth=0, inner_size=0, last_node=False) -> digest\n"
+"\n"
+"Return the BLAKE2b digest of the contents of file, given as a path or a\n"
+"file descriptor, which is read without holding the GIL: regular files\n"
+"are read in large pieces, or with queue_depth > 0, read keeping that\n"
+"many 1 MiB reads in flight (using io_uring where available). With mmap\n"
+"true, files of 4 MiB or more are memory-mapped instead if possible;\n"
+"truncating such a file while it's hashed then crashes the process.");
+
+PyDoc_STRVAR(py_blake2b_log__doc__,
+"blake2b_log(file, index, interval=67108864, digest_size=64, "
+"key=b'', ...) -> (digest, length)\n"
+"\n"
+"Return the BLAKE2b digest of the contents of the append-only file, given\n"
+"as a path or a file descriptor, and their length. The state after every\n"
+"interval bytes is saved in the index file at the given path, so that\n"
+"only data after the last of these checkpoints is hashed next time.\n"
+"\n"
+"With a key, the index holds intermediate keyed states: anyone who can\n"
+"read it can compute MACs of the file extended with any data without\n"
+"the key, so keep it as secret as the key.");
+
+DECL_BLAKE2_FILE(blake2b, BLAKE2B)
+
+
+PyDoc_STRVAR(py_blake2s_many__doc__,
+"blake2s_many(iterable, digest_size=32, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> list of digests\n"
+"\n"
+"Return BLAKE2s digests of each buffer from iterable, all computed with\n"
+"the same parameters.");
+
+PyDoc_STRVAR(py_blake2s_chunks__doc__,
+"blake2s_chunks(data, chunk_size, out=None, digest_size=32, key=b'', ...) "
+"-> digests\n"
+"\n"
+"Split data into chunk_size-byte chunks (the last one may be shorter) and\n"
+"return their BLAKE2s digests concatenated, written to out if given.\n"
+"Accepts the same hash parameters as blake2s().");
+
+DECL_BLAKE2_BATCH(blake2s, BLAKE2S, 8)
+
+
+PyDoc_STRVAR(py_blake2s_tree__doc__,
+"blake2s_tree(data, leaf_size, fanout=2, depth=0, inner_size=32, threads=0, "
+"digest_size=32, key=b'', salt=b'', person=b'') -> digest\n"
+"\n"
+"Return the BLAKE2s tree hash digest of data split into leaf_size-byte\n"
+"leaves, hashing nodes of each level on threads native threads (0 means\n"
+"the number of CPUs). Depth 0 means the smallest depth that fits data.");
+
+DECL_BLAKE2_TREE(blake2s, BLAKE2S, 8)
+
+
+PyDoc_STRVAR(py_blake2s_prepare__doc__,
+"blake2s_prepare(digest_size=32, key=b'', salt=b'', person=b'', "
+"fanout=1, depth=1, leaf_size=0, node_offset=0, node_depth=0, "
+"inner_size=0, last_node=False) -> blake2s_template object\n"
+"\n"
+"Return a template for BLAKE2S hashes with the given parameters and key.\n"
+"Parameters are parsed and the key block is compressed once; the new()\n"
+"method returns hash objects, and mac() returns digests.");
+
+DECL_BLAKE2_TEMPLATE(blake2s, BLAKE2S)
+
+
+PyDoc_STRVAR(py_blake2s_file__doc__,
+"blake2s_file(file, queue_depth=0, mmap=False, digest_size=32, key=b'', "
+"salt=b'', person=b'', fanout=1, depth=1, leaf_size=0, node_offset=0, "
+"node_depth=0, inner_size=0, last_node=False) -> digest\n"
+"\n"
+"Return the BLAKE2s digest of the contents of file, given as a path or a\n"
+"file descriptor, which is read without holding the GIL: regular files\n"
+"are read in large pieces, or with queue_depth > 0, read keeping that\n"
+"many 1 MiB reads in flight (using io_uring where available). With mmap\n"
+"true, files of 4 MiB or more are memory-mapped instead if possible;\n"
+"truncating such a file while it's hashed then crashes the process.");
+
+PyDoc_STRVAR(py_blake2s_log__doc__,
+"blake2s_log(file, index, interval=67108864, digest_size=32, "
+"key=b'', ...) -> (digest, length)\n"
+"\n"
+"Return the BLAKE2s digest of the contents of the append-only file, given\n"
+"as a path or a file descriptor, and their length. The state after every\n"
+"interval bytes is saved in the index file at the given path, so that\n"
+"only data after the last of these checkpoints is hashed next time.\n"
+"\n"
+"With a key, the index holds intermediate keyed states: anyone who can\n"
+"read it can compute MACs of the file extended with any data without\n"
+"the key, so keep it as secret as the key.");
+
+DECL_BLAKE2_FILE(blake2s, BLAKE2S)
+
+
+typedef blake2b_param blake2bp_param;
+
+PyDoc_STRVAR(py_blake2bp_new__doc__,
+"blake2bp(data=b'', digest_size=64, key=b'', salt=b'', person=b'') "
+"-> blake2bp object\n"
+"\n"
+"Return a new BLAKE2bp (4-way parallel BLAKE2b) hash object.");
+
+DECL_BLAKE2P_WRAPPER(blake2bp, blake2b, BLAKE2B, 4)
+
+
+typedef blake2s_param blake2sp_param;
+
+PyDoc_STRVAR(py_blake2sp_new__doc__,
+"blake2sp(data=b'', digest_size=32, key=b'', salt=b'', person=b'') "
+"-> blake2sp object\n"
+"\n"
+"Return a new BLAKE2sp (8-way parallel BLAKE2s) hash object.");
+
+DECL_BLAKE2P_WRAPPER(blake2sp, blake2s, BLAKE2S, 8)
+
+
+static char *hash_files_kwlist[] = {
+    "paths", "algorithm", "threads", "queue_depth", "mmap", NULL
+};
+
+PyDoc_STRVAR(py_hash_files__doc__,
+"hash_files(paths, algorithm='blake2b', threads=0, queue_depth=0, "
+"mmap=False, digest_size=..., key=b'', ...) -> list of digests\n"
+"\n"
+"Return digests of the files at paths, in the same order, computed with\n"
+"the given algorithm ('blake2b' or 'blake2s') and hash parameters. Files\n"
+"are opened, read and hashed on threads native threads (0 means the\n"
+"number of CPUs) with the GIL released, and read as by blake2b_file()\n"
+"with the given queue_depth and mmap. The threads, including readers for\n"
+"queue_depth, come from the pool shared by the functions of the module.");
+
+static char *threads_minsize_kwlist[] = { "size", "mincpus", NULL };
+
+PyDoc_STRVAR(py_set_threads_minsize__doc__,
+"set_threads_minsize(size, mincpus=0) -> (size, mincpus)\n"
+"\n"
+"Set the minimum size of blake2bp and blake2sp updates whose leaves are\n"
+"hashed on worker threads, and the minimum number of CPUs for that (0\n"
+"means one for each leaf). Return the previous settings.");
+
+static PyObject *
+py_set_threads_minsize(PyObject *self, PyObject *args, PyObject *kw)
+{
+    unsigned PY_LONG_LONG size;
+    unsigned int mincpus = 0;
+    PyObject *result;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "K|I:set_threads_minsize",
+                                     threads_minsize_kwlist, &size,
+                                     &mincpus))
+        return NULL;
+
+    result = Py_BuildValue("KI", (unsigned PY_LONG_LONG)threads_minsize,
+                           threads_mincpus);
+    if (result != NULL) {
+        threads_minsize = size;
+        threads_mincpus = mincpus;
+    }
+    return result;
+}
+
+static PyObject *
+py_hash_files(PyObject *self, PyObject *args, PyObject *kw)
+{
+    PyObject *paths, *params, *result = NULL, *mmap_obj = NULL;
+    const char *algorithm = "blake2b";
+    int threads = 0, queue_depth = 0, use_mmap;
+
+    if (!parse_batch_args(args, kw, &params, "O|siiO:hash_files",
+                          hash_files_kwlist, &paths, &algorithm, &threads,
+                          &queue_depth, &mmap_obj))
+        return NULL;
+    use_mmap = (mmap_obj != NULL && PyObject_IsTrue(mmap_obj));
+
+    if (threads < 0)
+        PyErr_SetString(PyExc_ValueError, "threads must not be negative");
+    else if (!check_queue_depth(queue_depth))
+        result = NULL;
+    else if (strcmp(algorithm, "blake2b") == 0)
+        result = blake2b_hash_files(paths, params, threads, queue_depth,
+                                    use_mmap);
+    else if (strcmp(algorithm, "blake2s") == 0)
+        result = blake2s_hash_files(paths, params, threads, queue_depth,
+                                    use_mmap);
+    else
+        PyErr_Format(PyExc_ValueError, "unsupported algorithm '%s'",
+                     algorithm);
+
+    Py_DECREF(params);
+    return result;
+}
+
+
+/*
+ * Module.
+ */
+static struct PyMethodDef pyblake2_functions[] = {
+    {"blake2b", FASTCALL_METHOD(py_blake2b_new), py_blake2b_new__doc__},
+    {"blake2s", FASTCALL_METHOD(py_blake2s_new), py_blake2s_new__doc__},
+    {"blake2bp", FASTCALL_METHOD(py_blake2bp_new), py_blake2bp_new__doc__},
+    {"blake2sp", FASTCALL_METHOD(py_blake2sp_new), py_blake2sp_new__doc__},
+    {"blake2b_from_state", (PyCFunction)py_blake2b_from_state, METH_O,
+        py_blake2b_from_state__doc__},
+    {"blake2s_from_state", (PyCFunction)py_blake2s_from_state, METH_O,
+        py_blake2s_from_state__doc__},
+    {"blake2bp_from_state", (PyCFunction)py_blake2bp_from_state, METH_O,
+        py_blake2bp_from_state__doc__},
+    {"blake2sp_from_state", (PyCFunction)py_blake2sp_from_state, METH_O,
+        py_blake2sp_from_state__doc__},
+    {"blake2b_digest", FASTCALL_METHOD(py_blake2b_oneshot),
+        py_blake2b_oneshot__doc__},
+    {"blake2s_digest", FASTCALL_METHOD(py_blake2s_oneshot),
+        py_blake2s_oneshot__doc__},
+    {"hash_files", (PyCFunction)py_hash_files, METH_VARARGS|METH_KEYWORDS,
+        py_hash_files__doc__},
+    {"set_threads_minsize", (PyCFunction)py_set_threads_minsize,
+        METH_VARARGS|METH_KEYWORDS, py_set_threads_minsize__doc__},
+    {"blake2b_many", (PyCFunction)py_blake2b_many,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_many__doc__},
+    {"blake2s_many", (PyCFunction)py_blake2s_many,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_many__doc__},
+    {"blake2b_chunks", (PyCFunction)py_blake2b_chunks,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_chunks__doc__},
+    {"blake2s_chunks", (PyCFunction)py_blake2s_chunks,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_chunks__doc__},
+    {"blake2b_tree", (PyCFunction)py_blake2b_tree,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_tree__doc__},
+    {"blake2s_tree", (PyCFunction)py_blake2s_tree,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_tree__doc__},
+    {"blake2b_prepare", (PyCFunction)py_blake2b_prepare,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_prepare__doc__},
+    {"blake2b_file", (PyCFunction)py_blake2b_file,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_file__doc__},
+    {"blake2s_prepare", (PyCFunction)py_blake2s_prepare,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_prepare__doc__},
+    {"blake2s_file", (PyCFunction)py_blake2s_file,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_file__doc__},
+    {"blake2b_log", (PyCFunction)py_blake2b_log,
+        METH_VARARGS|METH_KEYWORDS, py_blake2b_log__doc__},
+    {"blake2s_log", (PyCFunction)py_blake2s_log,
+        METH_VARARGS|METH_KEYWORDS, py_blake2s_log__doc__},
+    {NULL, NULL}
+};
+
+/* Free objects kept in free lists. */
+static void
+pyblake2_clear_free_lists(void)
+{
+    blake2b_clear_free_list();
+    blake2s_clear_free_list();
+    blake2bp_clear_free_list();
+    blake2sp_clear_free_list();
+}
+
+#if PY_MAJOR_VERSION >= 3
+static void
+pyblake2_free(void *m)
+{
+    pyblake2_clear_free_lists();
+}
+
+static struct PyModuleDef pyblake2_module = {
+    PyModuleDef_HEAD_INIT,
+    "pyblake2",
+    pyblake2__doc__,
+    -1,
+    pyblake2_functions,
+    NULL,
+    NULL,
+    NULL,
+    pyblake2_free
+};
+# define INIT_FUNC_NAME PyInit_pyblake2
+# define INIT_ERROR     return NULL
+#else
+# define INIT_FUNC_NAME initpyblake2
+# define INIT_ERROR     return
+#endif
+
+PyMODINIT_FUNC
+INIT_FUNC_NAME(void)
+{
+    PyObject *m;
+    unsigned int features;
+    const char *blake2b_impl_name, *blake2s_impl_name;
+
+    /* Start with empty free lists (objects left in them are freed). */
+    pyblake2_clear_free_lists();
+
+    if (!pyblake2_threads_init()) {
+        PyErr_NoMemory();
+        INIT_ERROR;
+    }
+
+    /* Select the fastest implementation supported by CPU. */
+    features = pyblake2_cpu_features();
+    blake2b_impl_name = blake2b_select_impl(features);
+    blake2s_impl_name = blake2s_select_impl(features);
+
+    Py_SET_TYPE(&blake2bType, &PyType_Type);
+    if (PyType_Ready(&blake2bType) < 0)
+        INIT_ERROR;
+
+    Py_SET_TYPE(&blake2sType, &PyType_Type);
+    if (PyType_Ready(&blake2sType) < 0)
+        INIT_ERROR;
+
+    Py_SET_TYPE(&blake2bpType, &PyType_Type);
+    if (PyType_Ready(&blake2bpType) < 0)
+        INIT_ERROR;
+
+    Py_SET_TYPE(&blake2spType, &PyType_Type);
+    if (PyType_Ready(&blake2spType) < 0)
+        INIT_ERROR;
+
+    Py_SET_TYPE(&blake2bTemplateType, &PyType_Type);
+    if (PyType_Ready(&blake2bTemplateType) < 0)
+        INIT_ERROR;
+
+    Py_SET_TYPE(&blake2sTemplateType, &PyType_Type);
+    if (PyType_Ready(&blake2sTemplateType) < 0)
+        INIT_ERROR;
+
+    /* TODO: do runtime self-check */
+#if PY_MAJOR_VERSION >= 3
+    m = PyModule_Create(&pyblake2_module);
+#else
+    m = Py_InitModule3("pyblake2", pyblake2_functions, pyblake2__doc__);
+    Py_AtExit(pyblake2_clear_free_lists);
+#endif
+
+    /* Add module constants. */
+
+    PyModule_AddIntConstant(m, "BLAKE2B_SALT_SIZE", BLAKE2B_SALTBYTES);
+    PyModule_AddIntConstant(m, "BLAKE2B_PERSON_SIZE", BLAKE2B_PERSONALBYTES);
+    PyModule_AddIntConstant(m, "BLAKE2B_MAX_KEY_SIZE", BLAKE2B_KEYBYTES);
+    PyModule_AddIntConstant(m, "BLAKE2B_MAX_DIGEST_SIZE", BLAKE2B_OUTBYTES);
+
+    PyModule_AddIntConstant(m, "BLAKE2S_SALT_SIZE", BLAKE2S_SALTBYTES);
+    PyModule_AddIntConstant(m, "BLAKE2S_PERSON_SIZE", BLAKE2S_PERSONALBYTES);
+    PyModule_AddIntConstant(m, "BLAKE2S_MAX_KEY_SIZE", BLAKE2S_KEYBYTES);
     PyModule_AddIntConstant(m, "BLAKE2S_MAX_DIGEST_SIZE", BLAKE2S_OUTBYTES);
 
+    PyModule_AddStringConstant(m, "BLAKE2B_IMPLEMENTATION", blake2b_impl_name);
+    PyModule_AddStringConstant(m, "BLAKE2S_IMPLEMENTATION", blake2s_impl_name);
+
 #if PY_MAJOR_VERSION >= 3
     return m;
 #endif
@@ -17,34 +17,88 @@ Hash objects from this module follow the API of standard library's
 `hashlib` objects.
 """
 
+import os
+import platform
+
 from setuptools import setup, Extension
+from setuptools.command.build_ext import build_ext
 
 # Version of optimized implementation to use.
 
 opt_version = 'BLAKE2_COMPRESS_AUTO'
 
-# By default, pyblake2 automatically selects the optimization based
-# on CPU indicated by CFLAGS. If you'd like to override the default
-# choice, you can uncomment one of the following options. Note that
-# you might need to add additional machine flags via extra_compile_args
-# below.
+# By default, pyblake2 builds all implementation variants and selects the
+# fastest one supported by the CPU when the module is imported. If you'd
+# like to override the default choice, you can uncomment one of the
+# following options. (If CPU doesn't support the chosen variant, the
+# portable implementation is used.)
 
 #opt_version = 'BLAKE2_COMPRESS_REGS'  # fast portable
 #opt_version = 'BLAKE2_COMPRESS_SSE2'  # x86 SSE2 (slow!)
 #opt_version = 'BLAKE2_COMPRESS_SSSE3' # x86 SSSE3
+#opt_version = 'BLAKE2_COMPRESS_SSE41' # x86 SSE4.1
 #opt_version = 'BLAKE2_COMPRESS_AVX'   # x86 AVX
 #opt_version = 'BLAKE2_COMPRESS_XOP'   # x86 XOP
+#opt_version = 'BLAKE2_COMPRESS_AVX512' # x86 AVX-512VL
+
+# Implementation variants and compiler flags they need on x86 (MSVC
+# doesn't need any flags to compile intrinsics).
+
+variants = [
+    ('ref',   []),
+    ('sse2',  ['-msse2']),
+    ('ssse3', ['-mssse3']),
+    ('sse41', ['-msse4.1']),
+    ('avx',   ['-mavx']),
+    ('xop',   ['-mxop']),
+    ('avx512', ['-mavx2', '-mavx512f', '-mavx512vl']),
+]
+
+is_x86 = platform.machine().lower() in (
+    'x86_64', 'amd64', 'i386', 'i486', 'i586', 'i686', 'x86')
+
+variant_sources = {}
+for name, flags in variants:
+    for hash_name in ('blake2b', 'blake2s'):
+        variant_sources['%s_impl_%s.c' % (hash_name, name)] = flags
+
+# Multi-buffer kernels.
+
+variant_sources['blake2b_impl_x4.c'] = ['-mavx2']
+variant_sources['blake2s_impl_x8.c'] = ['-mavx2']
+variant_sources['blake2b_impl_x8.c'] = ['-mavx512f']
+
+
+class build_ext_variants(build_ext):
+    """Compiles each implementation variant with its own machine flags."""
+
+    def build_extensions(self):
+        if is_x86 and self.compiler.compiler_type != 'msvc':
+            compile_one = self.compiler._compile
+
+            def _compile(obj, src, ext, cc_args, extra_postargs, pp_opts):
+                flags = variant_sources.get(os.path.basename(src), [])
+                compile_one(obj, src, ext, cc_args,
+                            extra_postargs + flags, pp_opts)
+
+            self.compiler._compile = _compile
+        build_ext.build_extensions(self)
+
 
 pyblake2 = Extension('pyblake2',
                      define_macros=[
                          (opt_version, '1')
                          ],
-                     #extra_compile_args = ['-msse4.1'],
                      sources=[
                          'pyblake2module.c',
+                         'pyblake2_dispatch.c',
+                         'pyblake2_threads.c',
+                         'pyblake2_file.c',
                          'blake2b_impl.c',
                          'blake2s_impl.c',
-                         ],
+                         'blake2bp_impl.c',
+                         'blake2sp_impl.c',
+                         ] + sorted(variant_sources),
                      depends=['*.h'])
 
 
@@ -57,6 +111,7 @@ setup(name='pyblake2',
       license='http://creativecommons.org/publicdomain/zero/1.0/',
       url='https://github.com/dchest/pyblake2',
       ext_modules=[pyblake2],
+      cmdclass={'build_ext': build_ext_variants},
       classifiers=[
           'Intended Audience :: Developers',
           'Intended Audience :: Information Technology',
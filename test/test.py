@@ -1,4 +1,6 @@
+import os
 import sys
+import tempfile
 import unittest
 import binascii
 from pyblake2 import *
@@ -80,6 +82,9 @@ class BLAKE2bTest(HashTest):
         self.assertEqual(BLAKE2B_PERSON_SIZE, 16)
         self.assertEqual(BLAKE2B_MAX_KEY_SIZE, 64)
         self.assertEqual(BLAKE2B_MAX_DIGEST_SIZE, 64)
+        self.assertTrue(BLAKE2B_IMPLEMENTATION in
+                        ('ref', 'sse2', 'ssse3', 'sse41', 'avx', 'xop',
+                         'avx512'))
 
     def test_digest_size(self):
         self.assertEqual(self.hash.digest_size, 64)
@@ -648,6 +653,9 @@ class BLAKE2sTest(HashTest):
         self.assertEqual(BLAKE2S_PERSON_SIZE, 8)
         self.assertEqual(BLAKE2S_MAX_KEY_SIZE, 32)
         self.assertEqual(BLAKE2S_MAX_DIGEST_SIZE, 32)
+        self.assertTrue(BLAKE2S_IMPLEMENTATION in
+                        ('ref', 'sse2', 'ssse3', 'sse41', 'avx', 'xop',
+                         'avx512'))
 
     def test_digest_size(self):
         self.assertEqual(self.hash.digest_size, 32)
@@ -1176,9 +1184,1958 @@ class BLAKE2sKeyedTest(HashTest):
         "3fb735061abc519dfe979e54c1ee5bfad0a9d858b3315bad34bde999efd724dd",
     ]    
 
+class BLAKE2bpTest(HashTest):
+    hash = blake2bp()
+
+    def test_constructor(self):
+        self.assertRaises(ValueError, blake2bp, digest_size = 0)
+        self.assertRaises(ValueError, blake2bp, digest_size = 65)
+        self.assertRaises(ValueError, blake2bp, key = b'x'*65)
+        self.assertRaises(ValueError, blake2bp, salt = b'x'*17)
+        self.assertRaises(ValueError, blake2bp, person = b'x'*17)
+        self.assertRaises(TypeError,  blake2bp, fanout = 4)
+        # Must not raise:
+        blake2bp(digest_size=1)
+        blake2bp(digest_size=64)
+        blake2bp(key=b'x'*64, salt=b'x'*16, person=b'x'*16)
+
+    def test_digest_size(self):
+        self.assertEqual(self.hash.digest_size, 64)
+
+    def test_block_size(self):
+        self.assertEqual(self.hash.block_size, 128)
+
+    def test_update_chunks(self):
+        """
+        Checks that data spanning several 4-block stripes
+        gives the same digest however it is split.
+        """
+        data = bytearray(range(256)) * 20
+        digest = ("723b1cf9f021d263dec879e1d621823f1c48b971e6636531d8dd2a77f7c5c6b2"
+                  "1d00d076d2af36d120ed15052923b63d6eaced191d106d06e99895045da5a1b5")
+        self.assertEqual(blake2bp(data).hexdigest(), digest)
+        for size in (1, 100, 128, 511, 512, 513, 2048):
+            h = blake2bp()
+            for i in range(0, len(data), size):
+                h.update(data[i:i+size])
+            self.assertEqual(h.hexdigest(), digest)
+
+    def test_update_large(self):
+        """
+        Checks that updates large enough to be split between threads
+        give the same digest as small ones. Threads are used only if
+        there's a CPU for each leaf, unless built with THREADS_MINCPUS=1
+        (the threads tox environment).
+        """
+        data = bytearray(range(256)) * 8193
+        for prefix in (0, 1, 100):
+            h = blake2bp(key=b'key')
+            h.update(data[:prefix])
+            h.update(data[prefix:])
+            g = blake2bp(key=b'key')
+            for i in range(0, len(data), 65536):
+                g.update(data[i:i+65536])
+            self.assertEqual(h.digest(), g.digest())
+
+    def test_update_threads(self):
+        """
+        Checks that updates split between threads on any host give the
+        same digest as sequential ones.
+        """
+        data = bytearray(range(256)) * 300
+        expected = blake2bp(data, key=b'key').digest()
+        old = set_threads_minsize(4096, mincpus=1)
+        try:
+            for prefix in (0, 1, 100):
+                h = blake2bp(key=b'key')
+                h.update(data[:prefix])
+                h.update(data[prefix:])
+                self.assertEqual(h.digest(), expected)
+        finally:
+            set_threads_minsize(*old)
+        self.assertEqual(set_threads_minsize(*old), old)
+
+    vectors = [
+        "b5ef811a8038f70b628fa8b294daae7492b1ebe343a80eaabbf1f6ae664dd67b9d90b0120791eab81dc96985f28849f6a305186a85501b405114bfa678df9380",
+        "a139280e72757b723e6473d5be59f36e9d50fc5cd7d4585cbc09804895a36c521242fb2789f85cb9e35491f31d4a6952f9d8e097aef94fa1ca0b12525721f03d",
+        "ef8cda9635d5063af81115da3c52325a86e84074f9f724b7cbd0b0856ff00177cdd283c298326cd0917754c5241f1480fb509cf2d2c449818077ae35fc330737",
+        "8cf933a2d361a3e6a136dbe4a01e7903797ad6ce766e2b91b9b4a4035127d65f4be86550119418e22da00fd06bf2b27596b37f06be0a154aaf7eca54c4520b97",
+        "24dc1e6dc4e51a3a3c8da67aacb4c541e41818d180e5bb69753dbbff2f44d0e7da830386bfc83b27a59dbb62b964fc8ea6cbdf3049bff81f24f348db4efd0d07",
+        "bc23f5abdffd6a32a5d40811262ed4479ef70b4233ca205bc5b9bf8596731982d04169a904dd43b0e0f94899f733022d24d84fad0a991600f1979b272ad62073",
+        "ef107fcd0d92d84ef5ef9463e6e96241254529d2b97fdbe56419070adbc7d5706feb8f449579819ed4be619785fffaaf0d9789cfe726249ab08c9468cb5fde22",
+        "231fbfb7a1ddc5b74933a285a4224c049cba1485ce35640d9c516ed78eaa226d36f65b2589b826c459fa6a91c426fd2a8ab461c9767e7bdd996bef5a78f481b7",
+        "3a831f2da969b9b7360e74ee53b518980a5ebcdfd4ee23ed805c26394d1824208d7e8f6327d4ec87979ce4af8ab097d69e261ca32db0eefdbc18d16377a6bd20",
+        "8349a20fddbae1d8472b67f0347aa0fd404d65c6fa1472b310390d7565ba6bc10260d3dce6a14f4dd9b8b3e0a0c47f6db7e7100a7a9b64a844f01064d07905c5",
+        "239ae3d6859c7c972a5dc8b9c55aeb938590cfb8552aa305a6f6f31ffa95a840f4ec36f6fb8f83b69c1da981fc9ba16360db0f4f7c68eb543ed58b28756a1e0d",
+        "7c5673286308408fbc62240e074728b27a575cad2a156e00b5c08b218d8887791e47bf10b0bc61a582545a2469639ce628c40f20ea8b849cd005445f29a08cce",
+        "dd077e769e0def78dd7aadd57d58421bda3a1a4e6972059f8e649cd6bca44a13ab71eb535d244922948465d73bd64efb091046949066653603575a2e891ebd54",
+        "b36cef28532b40d8178628f0fab5e5b4a1dec0c0e911d727bf09490f5e8d9fac57213fd2a2d12ed3d77a41f5e2fecc40e4eeca1612f51c452331ae93966235bc",
+        "de737dbc612ebd31bc49a2d7c644d4b137817419421c32f4e75114d899e3131d45ca5451248f24169fbf17ee60a9b70798a4b937cea62795289639d18fcd89e4",
+        "b4c1bbcbbccdfce4d2be9dcdb983c1b020c5f720da5becf4cb2a9a3d1b8d23cea7a9f5fd70d3740ecd67ce7d1e9c5e31a3302df66a9b5d54304490fbe1c4a8b9",
+        "b1d65e70c69ba7e3a728e8b6449493f237510b23b6e77d9584d05ff4d3f08780929d74fa5bed9b75d4d6d1ca91ab8d2637dc2e79ba0fe0594acd68fb3cc660b9",
+        "da79f729eab98c04f37fcc854b69a84e467dea1e7782e7af02cb44a49d210d2523683d420ac1dec8ad1fb40e65ab3fe251a851e283d85838084261301ecd089b",
+        "714040403921ae5548a20339d69e093f609aa99c22db72591d1ef4fcb0af016173e577d8c1a3063b443a0e48f313cf2e0f9b0c2ef96a96c424322ccc0cd5304c",
+        "8b2e8c3f0e3c319ba67e86014bda683e5357a04037b4563286ac89cddb7ee04cf6675f9ab61fc8332d218d2bca9715e7dbe58372d1eebf6bc2948471cfcebb77",
+        "32ee9549d4e32f4be9c500bd8543afd0b69782d0b3ff7ed47a881a0e491f37650a21b26c3f5d0a64e09058b3004a2368b950e47230c22966d3f79da7baa0b87f",
+        "cae7f292713782c471fe3178a9420cd4c11fcd3f6dbe5d15c84ab7353c739ef0641639a2f92aed31c56a2021cc5e58cbead374e2dc8a0dbce5450fe7a018cfa4",
+        "f17fefaeae7d40cd885dac0bc350c0273668ea0222df5c75694f5cb3a321519f6e0ec43ba0c8593dc7341341e519488f20abd5b8124dfacea5cde0965b6970f9",
+        "e2cf86ddc8424ee547eb7245b7325e02f2e3ac013c8d386b3d2e09208a9bcc0b44c4c438eaaf52d2077e9177eb8ee1d59075b52592202062229354bf23c96239",
+        "38f26a1102cb162d351f843b3c49f6ff85441633b6704a286af81ccbae5a67d3015cc0efafb7057dc2b28d6766e82a068a4c0b524b66d0a632775d93061575f9",
+        "a2c4302daca7a7c632f676304e6275c1c1f0dbfe38dc571cb23e1f7ba5dc18180fc48a015f927c89967c1e104e66f5ea5b2dd31d781c3849bfc649220c385c82",
+        "c19c6b3fb5352bb394c26846523c25e8265d505f501f9603a4f8bd55386cf4cc9f4d71f38ff445f4efc83098d47969334e79a2bcb4026bc63b7959dedb62b7bd",
+        "1f4ab9840a1cfa8fe6c5622d9b538becb8807a8778b69d9305f908576573b20ca3704e89129726d502e198588d072668bf03630b5b5a9232ff392527249df99b",
+        "fe03177b58b48883a86d4268334b9591d9fbd8bf7cc2aacc5025ef476b4533ba7bd781df011147b3cf511d8b3dcd8c780d30d7da718c22442319817be3186bc5",
+        "f4c3b059105b6aa5fe78843a07d94f712062cb5a4dd6059f97904d0c57973ba8df71d15a511a066864fe455edc9e5f16524cec7ee248ee3ec929063bd10798da",
+        "57a16f964b181b1203a5803b73817d774483826cea113b9ccfcf0eb87cb23064284962d847bb1fae8cbf5cc63b3ceaa1241ea42c63f898011fc4dbcae6f5e8c5",
+        "7952fc83acf13a95ca9c27a2156d9c1b6300b0ef790f572bc394c677f7c14629ebd8e7d5d7c7f1a5ebbdc390cc08cd58c2008900cb55eb05e444a68c3b393e60",
+        "2c2240d6b541f4294ff976791d35e6a2d492f57a915fbac5832660c10e9c96465c7bd5fca751bf68e2673a638e3af735b02091d75d1a7f89e3f761c5df821a6b",
+        "59dc846d3405ccd806f8fa20c8969ef68a4385ef6c274eee6dc0692c3ecfb1a834ce644376c52b80421bae94d6c7fdcca5a8f1859c45a10c4eb274826f1f089f",
+        "b752962707a17b664faeb313e2b952dc03e74a7e9447098aa6d4ea5bd287d07a1225eceda9811570580a512b2b20b3fcfca70b44f6454ef3c3524cca6b69475b",
+        "da0d8e5461f81024effeed5d7076a04fededac57e7c98a5945bfde66755818851be1136b71f433a56bda1841ae71392c4b8290826359f587223c3ef737ff732a",
+        "edb86a237c6f137dfbb347011edb4c6e861f4d58146085463441042fa36316f1faf88711bb0f1811dfbbbfa7b51f9ce2d49605243ed016cbad6885eae203674f",
+        "e6d8e0fbaa29dbeb60f3c7f985bad754d721aac63da6f4490c9d7ea231d2622fdfdef148d0ca442b8d59cf3e4f9835cbc240af40fba63a2ea5a235d46eea6eac",
+        "d4e463c4882987eb44a5ed0c821d68b0fef99d6f53a57bf319bdac25ac38eb0b23e1138c0012f5f38346a1de9d4a992a64b942834a856efbaa0620bda29f6a86",
+        "42d810d01c2da24735f04a5e901338fdfc2de1715ff6643a372f880e6c5c6c13d2b3ad7077469d643354054d32dd8049ea63732b5745bdb23be2b58e48c1013a",
+        "cfbf5430076f825a3bbb88c1bc0aef61259e8f4d5fa33c39825062f15d19fd4a0182cd9736d2aec9749ccf83186c3574ab94426540660a9db8c3aabbcbdd9d0f",
+        "6c2434a1afa157accc34a5c4872dff69fe7f3196cb1a750c541d8b73922888babe89b1c38202218620d88d77dad9dfbab3fbf740b2d1d8f37ead258e2ef10652",
+        "48b7268aa4342fab021d1472e9257f76585cc56810c8f2a6e1d4a8946b777142d44ae513a8809f2d6dc726305f7944604d952d4a9f085c5c1050bafdd21d1e60",
+        "cecfce4b12c6cf53d1b1b2d418a493e3f429170321e81aa25263aaa715d5ca389f65c3acf99b180e446b50e601fcbf4461d0426a8592a07742201857125f71ee",
+        "385a752242eb9ed56b074b702c91e75aec0be9064bd9cf880304c213270cb2eae8e21d9ae8c6081519f75dfabb003b2432b04755b8c32c97ac2914e8bf45b234",
+        "d89a124a9b958ba23d09207acfa62a33b87089b286e8438bdc01e233ab2a8630a1eeb6b2b9ba6b7d2100107733deaf4c20478c26f249c689c5268473e2e9fa60",
+        "43de1092ff9ff528206c6fcf81322ead3d22eaa4c854521577df336247495ce172fc873995300b21b94610c9d2f633b533bde4568ca09c380e8468fe6ad8d81d",
+        "868b601199ef000b705cd64d3930262a5ab910e34e2d78e8587b4e010d376dd4a00de44867d0e933ee39a1fa9147d499d184f3a9cf354f2d3c51146ff7152d68",
+        "1517f8f0442f0d50bbc0aab6846fdce3b70faea4bb5113acb23abe101d99a40a1b76c1e8dc2ea1936294823ad8354c11e2e96c6712be4cf77c583fd06b5e5c55",
+        "af4c6c67c5ca38387348ca3ec2bed7fba8c2b3d22de148d08a618c297023fb7b6d2c153d5efcd1688999910b20e1eac7c100a2c5a6c1acf5e98f143b41dc8a12",
+        "a2ad94243b8eea68f5fadd6908adb0dacdaa6a6d24c250d339403dba8231bd51e887cb5b1b7bde2774c6b08acce0f7495648da3bebc7b1c2821508c4d382f730",
+        "28f88cdbe903ad63a02331de1a32af6dbba82d7fc0798702724933da773807bc804278134781f126233220e307928131b24710b4674ed705112f95d1aa37a2dc",
+        "5bb29265e246b884ff40914ffa93d9a12edc19eee9cc8a83631d68bd46aad3354ba6674b913f4f823e791f0cb19ea6a67c6e32e9be0d0ff5760f16dd75a87b5d",
+        "bf3c06dc6d94e3859a4daa50eca1af5357e34579e599f82049e1cca7a7d4f33fea443b44691bd43688f5550531cf22b71277890bffae1ece783f5663a1c4d71a",
+        "c90df532f2f1493a1155be8c2a4400922049974e7d4f4b54f820c2269d3b161b6e88eb776b859b89b8567fbc550c4f54aad27a1610656d625c327f665dca707c",
+        "3d39eecc9e904236dc857ba49d55d3bad76572a91a759503376b7708d62d5a785c23068059cf68897f23eec507219b0a02eda2d8bc94fa6989a514822203c8d1",
+        "e08c54d998f92b7a54a24ca6aeb153a64f9c9f1fc33658b3edac2c4bb5263158dadf00d3519a119a5614c7f37940e55d13cce466cb71a407c39fc51e1efe18da",
+        "74767607041dd4b7c56b189ee8f27731a5167223eb7af9b939e118f87d80b49ea8d0d01f74f398b172a8ad0dbf99414f08d2b7d8d75216a18225273d8d7fd05d",
+        "fee89a92ccf9f1eb084aaba95497ef0f30134c191cf90a49d22c7d2f6614993cbe1a4b6513edc153868a3d562b5b0226ba8e1b0dcb69ed45af47ce4f86ba474a",
+        "cdae94b6d1d835f6c74c76ec3a2db65bbdfae19d7b050dc95d658733b8b22c6f9e0b63cc905a29ea8878ca394556b3673c62791546a9a1f0d1565fadc53536c1",
+        "c7228b6f000017d2be4bf2ae48addb785e2735bf3c614d3c34231f1d0c887d3a8e88880b67ad3b2f6523dd6719342cd4f05935d2e5267f3680e773bd5eadfe1d",
+        "122744fe3fff9a055f0f3bde01eb2f446b0cdaf3aed72caa2940741920120a964fcff87099b08ef33496e399032a82daad4fed3031172f77479258fa39db92fd",
+        "1fb4e367eab642b72e43ad4abdfcad74620c3f6c63a8913128d2226eb192f9992eb9c8f76ae206d3f5dec726a5a686b4ae37b557ab57f956485334f73dce02e0",
+        "0425caaa923b47b35045eb50829c048bc890444afeefc0afc9d1877b821e043c9c7b9d6dc33fbbdfa537c1ece311965b2fee8982bc46a2a750bfc71d79dbea04",
+        "6b9d86f15c090a00fc3d907f906c5eb79265e58b88eb64294b4cc4e2b89b1a7c5ee3127ed21b456862de6b2abda59eaacf2dcbe922ca755e40735be81d9c88a5",
+        "146a187a99e8a2d233e0eb373d437b02bfa8d6515b3ca1de48a6b6acf7437eb7e7ac3f2d19ef3bb9b833cc5761dba22d1ad060be76cdcb812d64d578e989a5a4",
+        "25754ca6669c4870840388ea64e95bd2e0810d363c4cf6a16ea1bd06686a93c8a125f230229d948485e1a82de48200358f3e02b505dabc4f139c0379dc2b3080",
+        "0e26cbc78dc754eca06cf8cb31fcbabb188892c10450890549b2d403a2a3c4577001f74a76bd38990d755bae0526648329f63545ed16995cb1e6343f189f8e6f",
+        "58e7980b8b1a0b88da9da8640f2b96e3e048366130c266217ddc7953508f4a40d1674dabd39289e3f10c611968ccd1e9ccc18cadc7774a997dd1fa94e8354707",
+        "696fb84763e023584b35907a8b8aaa9e0e786f2ca5914541915848fb6ddab8d3d2eab600c138ce6717b0c70259d3193ea15695c850537f2c706ca4af158e957e",
+        "23de6e73079c8c2047a7846a83ccacabd371163b7b6d54eb032bc49b669742be717b99da12c646ad525706f222e1df4a91dd0cc64df182da00731d439c46f8d2",
+        "bb74f36a9db696c93335e6c46aab58db10cb07ea4f1b71936305228390959478f8734e215490e9ae2a3ec8f7f76733ae3f8b9a3fd7c406c6cac709975c40f856",
+        "ec6304d38e232c096ab586cadf27026dc5e53217d0e8b0c60adaae22f4e8c22d30bc5177f1c83acd925e02a2da89595fc106090e2e53edb31cdb76ff37eb6180",
+        "92f9fc6bc59a543f0dc9a1798fb1e5d523474e48ff3e29497f7280d1c408c8663348fe2af78f6c4e5ef5c0a017f3d3f215ecdd7a400ac5773b9e256068845a92",
+        "4a25b562f2fa01ddee7ea2e9fbf52f8c756d28db4a8bf70e740e9027426e51639df8788d133856858d01fddbdd5b987944c300dc7f8241fbcefa4f12948afeae",
+        "34212dd9f0651f81809a14edbcf7f3acdede7872c7a4847bea9f7ab7597382477a4cb8479a276321235e9021579446a4388a99e560a3907aeef2b438fe6b90c4",
+        "d62cf7abbc7d7bcd5beb1ee48c43b804fd0db455e7f4febbcff14b05be9047e27e518d6d3a6ada4d5863b7ec7f8492458940ac6bddb506592ccbc896afbb77a3",
+        "33a3a2636f9198d37a5ff1bff9eb10024b28468039f491402d39b708c55d27e5e8df5e3e1949958235cad980742096f2779a1d71dad58fafa3cd02cb5eaa98c5",
+        "b7a38990e6f4564aa3d93a7937100c29f940aff7cb20865a1c218981a5420486081781f8d50c86625cc5d76d0f5ccc4eb65d436609624f21d05339ab0cf79f4c",
+        "9d665a3fdd10459e77f03ac8c0e239019489693cc9315aa3ff112911d2acf0b7d276ac769bedfd852d2889dd12db91398b01c4f4a5da2780b1defe0d95b63270",
+        "70fb9efd5bca7f19b6e31d640dcf88d77e768ae227ecb3fd6b47137894f549bf1cf06e5db4546044dd9f465c9c85f7284fe54d2b7152699be4bd555a909a88a9",
+        "7afdb0193087e0c9f8b4dd8b48d9f20ace2713afc71bcc9382b54290aebffeb2d138f4dcf028f9c43cc180898477a39e3f53a8d1bf67ceb608261fae6ddb1abc",
+        "05990d7d7df1d484f5b1cae9ee5dfcb43f2cbe186c1a5b181a3731d4b1548ebff5bf61cb0f6d9fc230f25e8678b799e0e83026a0866bf0acab089e102e67ab6b",
+        "1af7a5ce587c8d87c7b79fa3e723d74ce026b5286752fd0c3742c6f0418ed785990d21f28da839ce8212ed550c373e6d3a75d55c31770441eeaff2d50f6e61b6",
+        "ddee0c76c9bdd32d7049354cfc85dc6867e2492e47feb08e3983d0b678845d7ec6c9793c3326bfdc1e113276d177fe38825204dd00073989c081cc3b71c68d5f",
+        "de070648b37c47dc9f2f6d2ab20773cd82fa5725a6900eb71cddb0c9f39b31df6d0773246e8ef9034967752db7ed22733f4379948dc396dc35adbbe9f6537740",
+        "a6456fbcff9e3d5b116a0e331a1f974f070e955609781fa599d608a31da76ad8abfe346617c25786513b2c44bfe2cb457c43fa6f45361ca9c6341311b7ddfbd5",
+        "5c95d382021891048b5ec81cc88e66b1b4d80a00b5ee66b3c0307749e6f24d170d23facc8eb253b3562bf8a45c37990cd2d3e443b18c68bbcc6c831dfde2f8e5",
+        "e37400dbd9210f3137acaf49242fa123a052958a4c0d98906247d535a351fd52296e7010325bda841fa2aab44763763c5504d7b30c6d79fc1dc8cf1024466db0",
+        "5273a3a13cf0ec7200442cbd7b374466a7190ddca131d963f8f83965aed3dd86e9d45ab489b9c56247c9f2aa69fd7e3187b8fa0dac77c47cb295ba6296784394",
+        "2adb9349a9ec37ff4962f4217e80ebdcd360967b513d1202d9982831155d2f43eb9add63b5ec10d3d0430dc9cf7648117fc60babbf8ebf19facee550455b60c9",
+        "acaada3e4737c663ebf03c0249cca6f3179a0384ea2ab135d4d7a2bb8a2f40539cdce8a3760fd13deeecd160617f72de63754e2157cadcf067329c2a5198f8e0",
+        "ef15e6db96e6d0c18c70adc3cdb32b28677402e8ea4411ea2f3468ed9382e19bfecaf5acb828a52be16b981e487e5bb4a1430865358e979fb1071fb95114ffdd",
+        "057eab8fa61c230967d95dfb7545570e341ae3c6737c7db2a227d90ff315d098d476f715779e6772b4ed37548266e6598c6f096913c2fdd8d6e44fe2b54d9780",
+        "ede68d1b13e7ef78d9c4ee10eceb1d2aeec3b8157fdb91418c2219f64149747017aca7d465b8b47ffa53644b8bc6da12dd45d1055e47b4d8390eb2bd602ba030",
+        "27f856e63eb94d08fbbe5022b0eddbc7d8db865ef4fec20586df3dd902a05b26359e267c788d7c88032e766b118740200f49cb4d6edb1561b2de7dc65ee6423b",
+        "e9e98d6de0ef53fd2427661e1acf103d4caa4dc610036209ec997419c120631c2c094a8ee7822d43f8778011c603111f2628f897c9b431315477756b032e1f8d",
+        "52eb1e6c8a54492ca760b56ca87da3e1a9a6d8a4219219351d18715a9a2c26708bb712cdac0434482e551cb09e3f16338de29be2c66740c344df5488c5c2bb26",
+        "473fa6c51a48105f721c5cb8dba61c64a1e3ddccc3250e682262f212c01ab4874aff688fea9637739e2a25d2ee88dbdcc4f04d01479b301717533a6432b850cd",
+        "6b7660d410eae5f35ad0ae85e63da453ebb057e43f42e842cbf6250da67866b4240d57c83b771b0f70663e17fbd9087f76b4ce6bcd0b502e3374b1509bba55a8",
+        "a4d08aca7a9ea6439999ea21e4cfe9869bb90e3a014871ad88ed3a97aa8915951c3fd0b3933a508588938af7544944ef43c440aa8ff1e5a818a466435de70fa8",
+        "85e0e9b50d2db022c239d7232ae47c025922e4f07e2afc656cdc5553a27d95bfa58a574d4ec3a973281a8f4e46a71ab0341c2577287463e251044db2398d55e2",
+        "81a0d02442905191163370ae29c7f89c0f48bc1a1eb2947047da1c622b8677e9ea9beced55d33adb1553bd584ad2f86a6207e84e40e4607e11650ee2879f4e0b",
+        "87790df6cf7394451bcc730e53fc57be564522771e14432a80ab0b06b7b1d209ad698995125385db8b3c0959b8a5339eda0ae67859d847f44c81597272cbf195",
+        "cc064ea853dc0152cc03feb5fb5de78b9b88e96155d5358bce84a54c0e0c42fbda092f22d056df9993262e2ba44a5b2d53c3759d0945febaa6fd51b8ff38d839",
+        "7e517fc383ee8c9f0a01681d39e73beba5969595ce77927f91691f33bb3e1307ee03616c27e6795186f6940fedd9d5c7f21b6d2aaf70299cdd835125050a8b3c",
+        "845fcfa67f6e065510d262f1dd6939ea4c0a4a59c8ee3977db7005e1aee420bd3f3826ecfe59015b4dfa0bd5bbf8d8a434485dc11cb9cc8597cb8c9566115f31",
+        "17cf2c23215bcdfc243d8a945f3c5c251d2718a3f75fed6f3320bcc6fd927386d56f8719cca02ec5e99cdac4ea1095b465ba9a298b1d238e38b3fa15e8b14ee4",
+        "d789cec7d7520f10e8b8b6c8409589df57b856b8245568f64e2d2183e359a784c8d26cf9b720f5df567b01f3f48de64d4f0db156be525d7c7a665aadc591f0b6",
+        "b5e246a9027710c0b055c71f1167e0ee36ebc432cf5d142775a7aecccea78325ed8c12f50fbe648addf059b8c02a61492f8357bee142e7f7de043378dbcf2d33",
+        "b523fd77ab9eee424872bc2e83fc0a77ff8a90c9a0ce9e8c87680a0f6286331f15c93a2afecf7566653f24d930c323192d3043b905721cbdb63111ca42f28f4e",
+        "4359a45876bf6acc0aece7b9b4b4a838b9dba5776a3b14da2fba9102e78bf648ffb4d867bae85fd9b71312dc4602d0d49c907bb9289b2295961e54138123f54a",
+        "d3f2c8e74f343a4e7190d475cf9af754eed5577262b35bd9a9c42b58ce88262e3114917fb9e683c62d9f8947b58a294da506fb86b3edf25cb9e2d2df611cd448",
+        "41b890f8e8450dadb6959accba194917e02f3067821d4e995a37ac18ba3e47c7506e7a3dd1e112e6ec41bef530851120894a7b34b3dbcdae407327f0c5736edf",
+        "19d7144f0c851eb8b053a3a43586526dc5c773e497975164d11151364368df24bc44d536072304d70631a840b636b966fd028f61062bfc5285670153a6363a0a",
+        "c2184c1a81e983be2c96e4cfd65afbda1ac6ef35266ee4b3ab1fb03abaddfdd403fffcafb4ade0e92da382da8c40222e10e9fde856c51bdacde741a649f7335d",
+        "488c0d652e42fd78ab3a2dc28cf3eb35fcddc8def7ead4817bffb64c1ae0f208f78cf40976f7e2a2cb2dd30f1c99130208ceb692c66880d9528cd6d38ad29db2",
+        "515b65bf65688399575f0e0677bb6a919b66335546d6cae336f5c6feae5e2bf745e3a7b13c3205dd8b5b92cf053be969df7120fcef77e3895f560fd232fb8950",
+        "3fdbc7d69f4b53c225663da30d80f72e54281044a22b9882c6638f5526834bd31601ca5eb2cca4f5ffcf675dcbcfca60c8a3612d1aa9dab693b2356069603a0e",
+        "4ff6c31a8fc001ac3b7ae020c5f7c45efb6271a2d7ccab8713e548b729f0fff9c82fd4db5cf65643d4076a3fb17b3e893c302dc75b6122ff8681d037120e276a",
+        "43dff260dfef1cb2d61600e240aad6b720e5f4f83086e26a49a0ce3e0ca44b9a60fcf46a8c3f1bb1a6f5762b66513fe3f7c5b0bc150c08491acbc4361cabcfdf",
+        "b4dea94c9d3675be0512efdea8163870fe3425dcd761f363c43a0ca5716b76540663fb2be49e2db106485c9cdd3c164898a954b58748c42fea16a40fc453d210",
+        "e5277b6f93ea1de3e2d9fcd8c679793c6ccb8a3be26e8e3114f35da4f2ac014f55c2f15e09e94aa071298167a2fb9be311701ffba9d3eeff8ffc7993a3cece18",
+        "f095a7c6e2b91664734f3e23f18eb2ba9b00e71fbfcb9931c0a614792a9d8675622a874c1bf5241a2a8741ed1c893bdfa8e28c2e20bb1c58eb4de7d801116c78",
+        "dfa1fd803a1d4a3e661df01f4943ea66260a18fece134d62f97dacdb8b3bf9c800afe579cfd13fc0148bdefbff4e7683561c06a6f7225e4781993b4f4f2bcbfa",
+        "2b86ceb270f6908d8b160075ea7f57163af5d5c6f8aac52040cc687c17abf3c778c13906e0e6f29a6ab123deebce391f907d75d3a2cefa0efcb880a0e70d7196",
+        "32466bcbded538e568795430352536feb919bf4d97cc44ab1d805040f4bc4c2e7952721018958b4ee78303590ef6ac450df92ec77f477054bff867b88971d421",
+        "ea64b003a135766121cfbccbdc08dca2402926be78cea3d0a7253d9ec9e63b8acdd994559917e0e03b5e155f944d7198d99245a794ce19c9b4df4da4a3399334",
+        "05ad0f271faf7e361320518452813ff9fb9976ac378050b6eefb05f7867b577b8f14475794cff61b2bc062d346a7c65c6e0067c60a374af7940f10aa449d5fb9",
+        "b545880294afa153f8b9f49c73d952b5d1228f1a1ab5ebcb05ff79e560c030f7500fe256a40b6a0e6cb3d42acd4b98595c5b51eaec5ad69cd40f1fc16d2d5f50",
+        "bbfb9477ec6a9f0c25405acd8a30d5dd7c73571f1d1a6e8ce72f8b9c941cf779b76403ac7f0450052584390a14eaa37c20b5bdb0381054a9a49534f81466ba9d",
+        "c8287e933d9504bffd7be2ac022b32f3f46d87a7a0e79bb2a1cbaacc2e84cd70845d0d427848a6d788d39622e10f4342237eefa6d3c012dae96cc8a650cc2e30",
+        "c4596fcb0a28d24aad70cf1853ec29dac0fb202d8ec140da300088bb85b92c30291946ad307c096e3b2866335c9317afe28cadab5d62c354329c98d993c5be1c",
+        "e88c38e67e8d19835808854670779eca60bad854c5778790a07254a30a14ae82b61bb16911fe57771d19e9b7f5023c0d4e8a8d372e3d85e43b03e5e00e6eba4b",
+        "2d663e03e6f3552ccdfba496a14cc6224ceb1eb61aa265e6a7d4a26e54106104a96e330959f9713b3487c1b9497ccf82611dbfa34ff11d3133b5b5d1f1e4f8d0",
+        "707d6a58421b8f7e44ff1f8362bc700f71ef7c3935e0764bd14d390c1c72792af9c2c02fb72a2b9d9a0729cb3e99626cf034df54b506b5b16464f475864f2590",
+        "9d88f8baa4eb0f9ab2292e4982ac80445358227d7f9ce7a4a629f180f7141e08fe6355c64521a69ba2bfbd1c4a3ea048d0bc8ab3701f30ea83fbe02474d892bf",
+        "65ea4db04a7581c18194a8921afdfa4f8d9af629ded2772c658e08485f67ad2ce21a98cd293ff28d4dfcdf658cdc7ae67027848e71ccc115a3ffbac4fa61bb73",
+        "0b4a68929e7f15ca91bb4439f2403702034cd4748e46927aba95cbef80048b25a675970fac33c874abd3d83aa0f37be2308310e8dd794f8192930ed56e70a8e4",
+        "c1c5d8acfe3fde674edd3620157a8b6b4c8e67c6a7a9726741d9c305e2a52a8797fda0b2f13ac78734db2f4fc83ef32414d931ebaeaecd826d7c2be203bdc2d1",
+        "2dadc8c9f7425a0114491287bdc68eae4fb6194d1a109db9b6e8a2ac94d4e440909985c4291fe89fd8281f8fcef6f6bc32550e53cb7a49428981e8d53cf5a212",
+        "e555f2a58acac5503f9e2d97b246872b4ca78bd56d47b765f052aab3dc77dbe993936f2252f0ab2e01fb087472ccb5a121ddffde531d3dc4022a7d1956ce0e20",
+        "9b4eae1295000aea7983ec3bcb4857cc7125fd7306787c63132473cfe8f4eb45318a60daad646d63a27c4b9d1f5073700a3057de22a7fdf09a87aac66ebe4758",
+        "9664acc2dc7298b9868db495eebc6b59657d139a6af060a72fb69124bdd3a6591888f0354f702b1b888684411058a3759f7fd37f06eafb3b58ecf26f4553be27",
+        "fc16e0925a35aad47ad69554b25796fcf9260cb50e6cc3747535559e99c85881c75889ac793ab78b88b05fb160895655e4d663a2a09ba9fa614a10c22947210d",
+        "225e7341f857524f7890376c50e6354b16c1cdfbf58fe5f3a4039493b5dd408d79d48c56e1f89b687fbe3362a77fa75a54374b7a485e91b189af2e2f749e2adb",
+        "a07a4c023ac704ce7c09dd6c92c6f184f53e8dd96fe3be9e93c39c534485b64b39d5be7f7b7170604de77ce5a437a98e712cc44f19e21d41f0e6e3ec1e00ac55",
+        "62858463582d22e68e5227bfbab540048f65edd6a6755f6fab53c025b663ca377a0ed5efd6af166ca55a9c733fca805ac4e409ca56177aa74940db9f40c3b9ff",
+        "a1ac539d1abbc2b096ffab813b64457fe6eb3b50fcd88953d0cd9f6502f689620ad442b5517090b50cffb958866d7c161d8a7d7560c893e1def6aec437ad6d06",
+        "b586b75da70f6cc0627ef3cf1237c94b12d0f74dcba26a9e7c7bc6c21a335337bf9f5b830c6324afa6ef649e95af8790875234c6e661d3f5e98ca012ae81488a",
+        "5668a2982137cbc622ef8d06cf4e86168cdd4a899cd4462af6c3d415426156a5d8dd67c9604f31b57d6c9d597250457e4ab52a58115542acf27f925930f6a112",
+        "f2b1bd16d88e37f3a518d193ed061a1df7b443a18ce9f84445ef86effbdff16055023cd4e78d034de4032a77ddc1d34352fe617f825624459bc3269f704f345b",
+        "f085f3d8bd138e0569243f74523e87ff376f04eabd5a2f6e53df3899000e2e94af0d2bc71c3f711025c538a6c8b10b0904dfc346adad7ef36b1ae88a6cfeabbd",
+        "8291a4afd2e4b71661773a46b3d4455a8d33a726d9d3873083ab337020c27b4dd643e28c2fe47ab2fbf5d14081a3fc1c839b12ea31d13cf49eee97ef2ed7fa3e",
+        "b126ae46a7a4595e31607ef807a5601f4ecd9e7d66c82daeb9715f8da1c17d7d71c3e68250c9dc01ac40a36d2e638bef3d7bc70ea2d0e331e3d33e1704eba92d",
+        "63b14d8ed2479caa17c3e4cf203b233a7e373edb0c2f197129a9a36c5b3e1f3838f2e82ac2c2ad9d52b335790bff577304a378e38eb6bb4162030ce2a8ba293c",
+        "34422a3229669928c490f57b8e768852e5b7c00dcad60b012a5db39a2d597c3d0a63be6a263ea53608b70692d78e1b427eacec01f4bee0bdbb8f0881488efc28",
+        "e26b7ed6b907b54ca26567f11ee5bb6d739a0008a53437ad7590a3134ceb95196e49b3443f324922517523c0cd5a00d77e4c4de7a0de968a84fb1b3be7b3b963",
+        "260197cafbf456b411fa26d383d64d61e81e5e52f84cd9d57386c776230c65a2681cd2fdfd28679f67fe1bd7469cf7269585fccbaecc22f503d6e3fc39301436",
+        "cbd5abe37bcc4f9a1270add0a5270f42839c7d249320d1f1d88553d05faf9a2679f49b49c9e20c1c85c629aa0f090cae8f6e32c6cad71721fd0623e4ed25b256",
+        "780e314fd697d2a97d221a22c39011e25069163cd08f0070d067e8cdb0bc8673fdb0ec4f46e31d748cd3bb3d61b9010a6612f341d471d9c5a2de6b6dd538a6b5",
+        "408f16ce86f801d08bd051364b3ecd9a3945715888df4663219a190b3504e4618e7bf55171178b0400fbebfaa01f6eeab54ff5e31e6d7a55b84adb9e03df4836",
+        "0bf98869ec0580199ca3708ec9c42c376c5c36e0fb749242572398a0da57f98d1c4cd2963b37c3c65a10f106b56dcb96dcdd325796297adbf6ee6270edd4592a",
+        "052c32984387b1930d3a96be72368535444f130757bf87e0762d8b1c4f6570f4dc674c4e6f5e21abd0b35e1ca19db840688d1b6e9ec91f3730e8b2880ec2c3df",
+        "4bb71409c15a0d3932c599ef0ff3eff5c7602d7000cda974082c4a4682249a19d43a5c14e0aeef897821056380aff275201d7459148496eae9420e718288b414",
+        "4795b251cc7b35e69692db7fb40efd34f294f51aec15d6c8673e59f204becf4cf9df849523f1db73be2a66c839d801974d433b47806701a163a794b26a846b06",
+        "dd50f965b60baf168f5ea05ac20b8a78f4475c18610b9d9fc2b7c3ad5c6f97a4cf5ea48ee40a3ca2293cc4214082cf0f8ec895553269e14da9bd1a196562ca59",
+        "e0b54b617f44922c7f61c6a54c98c61e932ded1fa9340266eea25f01e8180d1ddc6ad8dd6a0b8fab8c73aebb9773171bba04a781b11314d5a30a9d1c2812ca7c",
+        "2dc4ad0689a4460b5b399e911bdb41586ac8ad367b7aa39e3eaec8899a2d3ce38e34ab4608234d75eb6737fe215824c2a97883596f6f18ddebbf1627ded91d84",
+        "f56a11cbbf8a997e1477ec76e53c894b148d6925a4336f0cb7aab9d802ac9b4536f480101f3f9a77eecdcbae7aa6ea447a85da90b501f7db2ef8ddf5de173363",
+        "6e171d196d0fc82fb473e29da8f40f37ee9741ac3eaf175dd49fdb56530db59898baf3cee72eef5e77276cadabcd752ca3a1b864c10ad28d27eaad86e3f21d33",
+        "952012330d92bb9c1892f25b7b5aa0fed3c0398a1708509a661474a3f5e511d09f21c30008002f1042d83d2f7b11336b8c2fe1d979c1e386e02097489b2dfcf5",
+        "2dce47c33a7e7f215d34a5471bcd1110606c77138f19d41741ed5d1b89e8f7c774eec4bbc102766ea1532f2e43134ad366bdcc27d1a0cc959e1648659e44cbbe",
+        "7f0659597e7ad122d1c9ed91930b07de40e255201a33eb2b3181376e368df7764c0c14bf799f161b9b0079578b4709713e24e42fe7dd71b50943f440e23cd1be",
+        "1e66f7b358805dddffc582683e0bad818c873403d4ba1506b92fb320ca8cf9cee8154715d6db6f04093d4b3fd8a6fc8e7eddeaf2795b3d22de7c75ecff6f92af",
+        "1f60c18db168d90d2b4660e758a3cd28023d4c0b848b5e33ea5cc15629fd352eacb14f05fdec07ac23da9204745fa973c32955135f8ec7410a1cb53bc7580684",
+        "b9df57b345ee6f870ee0e63c558b81c1bc3842976fd3cfb1b53b766bf436d1d175f4d4c5f1bd8d7af65b5d18a72f9571f234701932afb7c3c94a8c8fa023db4f",
+        "d8c82495a2b5f66451f8c5b2e8a17333c2be3220ce06a814c2cea95cc86592aa0215bf294614a328cf07222b73f93f242a948bcae9565fc97057b52e0280eb82",
+        "8134ce66d95c4088a566d4e43599069ad04553b0fea3d74819a6fd766f436742f6b6ecc8279398609f60b4e4bb44fd72cdfbff18d8038aa71230838b126bc300",
+        "3da89f5c52b052e042e5117b96806edb1c55227e8514b39e8b22bea4c9533080a4d7a92492b751769b0e119ef4db2bb88d5c1e75b4031074d7f21a78014a1f96",
+        "9bdcb469c2665dd84683e58101fdae5c88292a4e05c400ca0826da79382b8a2826ff24fcd556c9d5b5aa892f02b1670477279bd75f1b2b7b675efac380607036",
+        "6c77857b38533e414af7387c98568d71c8f0e35e22b02e2a1c0dc6d57e37d868725ad823586a0beef39889cc31f1f7fad0960a125e29dfea745512d179e5f589",
+        "88c9833a6d44fc25bb64f3e98e838fb4ff564896dcd3583a8b57c9466e740c628b2d26ea147cb31110fbadcf9d0108accebe04317d19fc0366de0c28a1a45e2a",
+        "0aabb3a178464a0147645f05712a0a1555c5b9a3e999ab255aca35c50381f490551a408931aa6be9a4ef497a165b36663b1e1f05134802b178b7c70468cb98e8",
+        "5850d893706b3bc2dbba9cfab028bed819a28311d2d6f0cd8e272ee677bc878a0ced6c0dea9e5cc94b2b4f591a40ec9fb18222d6deace1f9c083dc05de117a53",
+        "bee696a4764f9425d91b141738625a0447a822bba7a84778cc3a77a386cb182487db513bb8f36fc2f7e6d2896e4456a52346c4948e3ec634cbf18f39c446cbab",
+        "3d9f75d3e50d9ba3bcac4a4e116b9b308dc64599a3864a9dafd75cb71f2de3109f7956a7d2dd374f8406d77f796311e3d30089e54dd6ce8abb02a85a85ae92e4",
+        "ef3951475a16df64983224046530dc7cb053d29394753911c4949950f23e8a92c709f46369b23a0d703a6f36490f75be1e3e8129a829f3dcd72d0e55497b8133",
+        "d4197d2a685bca6bfbdd0e3d84c748013548bc849fe649dae7c4a277fcbd8f818a9edfa6ca14d7feea726b23b4a33aa8a3f5a66167215c6148c06b94cd8bfe37",
+        "7a24403335b86410d8d693f163d6198a680f7e3ac025ec4474249b011677fe1c866aaf453db0e8f654335150863ace576650803191278e9d4b547a434c5654e2",
+        "af07c67d58743aeb1850eb53b2da78ecf7095818325beb866ff313e394c007e0c0b5a1cd7ae6bb37cd2781b52d154d18865d5e37dbaa5f96739bf7695996ae30",
+        "28b3c260fa7f23b9ccadd615a11469498adb18d7a9f684fde435c06533f5f508b29b5ecd0ecd57369f22f1c54e61be6cd104c8f7d3e1847aad67073a4786e1db",
+        "d643233325239e2ebd411f0e002330562eb1bb08e68824b71b98199c76d53158d91ddd6f4f8261ec1d72fc77c2cc237eda15f0257cf07b84cf1fbd1dbafa1dfc",
+        "3d7b44cc82efcafcaba6b1910548958c180a0e8d84bc663e8ef9533bd80c4bbaaa255b1981f756eb1079ad0f3471a1fc9d7a432339303a5781a34535309e5a24",
+        "eb0812c9670646d563198b117aafc56fa1b6560f88b5754ebfc31b355216d8d74d341e35b243bc938cf546af1f73c1b00455dc06b2c6c535279e8767498f14e6",
+        "7bba7d7304021c75b5d6ce66b4efa55019d942d208afac8211aa7e5e111e27697670e4ec91ba308ebdfb19154c3bad0526a62541ae5d43d0f547b9d98e073660",
+        "a8e2a9468da3e3543a23a578780e2562c7ce57fd1120e1c024d7ea3290317046616e14cd0f15a86b9939549b147611b6a55d85abc25f639546b89dd23d39a985",
+        "ce874cd6e1958b9d7f11ff44ab0832e848702c8f26656ba10bf5720a7caa1f5908c99a9603a98b416c57228c819ceaf827013b2e6d6b2dae59dff104b902c31b",
+        "30fffe37218db194b23273498f4544d38414bee41b1755a0c6c2dbcb411942d5ecb9d4523fb4794ba36e579af2f8dd851999233183fab27b47add87df35914bb",
+        "cef4431dce9ff55a00300ec8649e27583618224369f60a5c896b2a3110b032b87c9ee4f26c5f0bdb503ea7447a5db3f707fe3410dacdd7572219bdea8e17dc04",
+        "8ff0bcb75f0061b5f909298f569e45c75ed2d64a8189cebd4e02566e1a1b8be53a783228558e28b5f87ccc2f428f7f879744b525b24962b3604b120f06779f2e",
+        "7f8ddffb4dc15191de3ddbe4a0f88b7ab02d48e25cfc1fe91da557e885d012b8f65526c5b7b1013fc816585043a345605a39d8dad70d8a6448513250aac4f3d5",
+        "b1fe8c68aef6b4d4b23354eb8c1d8f5a56e32e76b96ac8443b2ab835e4c8b674b33e4c6c6dc121d7c2d34b59b37a568a1c98d500324e53088785b6b0806347d1",
+        "8e8734fcf9259ee37fe9c6cda282c2d5eb83d0cf439c8619d4b042ff69966b03565be4df96393fe6bf35afa16e0273b6d339c00995bf6f60a714ef180ebb9315",
+        "ae156d43a72c042942595878a783079760f521edb8b2c3d41a566b7cf74a4a08ea0f119d240a62ec73b9509788fa3aedf120ee88cb951b693f8f7caf8cba377f",
+        "9330aaca8c08844658c29506b1c34272e2b3c7b4e75e6fe99a0107ec5da4530fb1c88caa66dd9c471e01ca21a13a5d6f8215ded3147e94de2088571fd1bf23b6",
+        "c129f22c50f5997232e2b9f93dfaa00ad8a53429f9d15b9842e3ae08d849ebdd45238c85f92c6f917e0f8f6f94e234be076168e0df43d028455279a6ff65dc84",
+        "0e2b4bc2f6a75be4b7c9d4b53d104da065858d387b340bc1634f3a8332d54caa943024b213dc8d4f219ec8e1decac7d5c6ae69c9efd88149367838205d0dc7c0",
+        "83b543853b8142a83beff0735f201891e7ffc67dbdcd21a422bb336de32972ae0392646f6827d80cda654fd3a0774cd2f995517cf064c617f21a54275fe50c8d",
+        "09be15eb6a5c226f6d9508cba4a2519fba172af8375827d754a7a1bc1925d13f5e6343f3e14d08a06e8d37f8ec56fb438e623666b6fb0e23fb50477d411b0c3a",
+        "c35797e9832d3e2323335b8c19c5fa7491602dbf6bea77faeec9510bc2e891c8c3462199f60418d2e0abffe31b613bb980ea32b76c82438d025f678caf4824a4",
+        "cfc057fda78a50318f4978ffffaf771798e12c3ea8c798195bc5b4e6891e61aa25f7af4aa7286ac8507662c907ed913eda658f63fc47997c59b85970f878ca18",
+        "d8ebe0e638fc535b52cb0afce0f82dde285701aff329a54ba06dfd3d1b4b31f9f4b24d9d6836f1223d6de66bae7888febc2040cfe930e69ced59da6da8a0a6a6",
+        "16b8c55cf2f135a432590d2d4cfa38592f5935f8e71ce08a0206a0e5abea90b2e107eb86b918823bdd3bd2660722c8dbfa66abb9f8638e463402f657a168640a",
+        "6a6e89384f535f02176c48a993d3687b389bfc03050c777086355c1a55597742f0b74834a71d052ae8a83dc34a8fd7ba5aa69dbd612a4c22df4f74e2528fb7a3",
+        "1e4038cfa50d8b13ef68bec3b0ffd562a07ad634b5828257dba87304f823a900492a3137198b605cc7f77c33b8ca3d940fd9b338cf6b7b36e7d9d927209793d0",
+        "5ba6cd988ff9a4819142217ed65d437b413ba5026b554d8d94ea2702c096d1014775dba2cae96f1e2e7229c378f20b0389e119547fdd35224a617fcdcd0cb3af",
+        "2d20961230e250f81ddcd2d2ab3ef0dacf96851ebae5963447192cdb89e48e84f396ec9a09252784e173ada52a9c81acdab3d8d68380247ae975239b017dc1ce",
+        "35383ea7762b55310a7d57fbd5a54997579b0ba39a4eb887942bd14fd8483188e50048838d6c02dc758959a9f74d83372743e864c601ed7040a9e87152d4cffb",
+        "0b223b6a1c2d3ab3f9077a317b7fe32f6f957b7b1741f2717771834d3796a19ba36273c9eed64c07fa4e9af7a98ace9c789a79a5a0f94d0405aaf04af31ed797",
+        "5a007f5895524a5e8037036e0f2639fda8c5c1512d76e9d19b3dd2d5ba43f5079741a458313c5e02400ce02cb65680be282eacd9a254ef1cddeebdcee85d4187",
+        "be4dd1ccbde1670004d0efab6543e91c4e4664e5a2a88bac6dd27d27648d302a065be6078b22e4c4ab4f7f7cbfafc1ad86ec2a504fe5851766f7a3244757cb6f",
+        "0fb4483f9659296cb9245b57792a1e6a99f28790077287968ab3ef3589e6902406f1f39dcce0061dea940fc8c1c49f4b545eed59e96ddae96a6c35b5593c2977",
+        "41d1fadc60a46c9ad0120a3f54d005f5a1075e2f71ee0da618bac1461efae969eccd7aa575c4cdae971ded13ae13c506872cecb5b208fa72a94840023edb3efe",
+        "2f7fdc1da44b6e5d2decde821aaf4b49168c02e8d5f25d5c699871083aebd928b74dc22dcbedfaba9316aefca848d15f0517329903d34b8370ddf9bd58c6d0cd",
+        "88558a464ee1a8803b2395af6a6490842b5cd43d41f6c07cd6c5f85f82f58432a0b162b438bf0cb7082a7673e287d6b90f8d0dc8aa5ceba36bfa77b15ba06916",
+        "ecc149917b266398b6f3297e969673b14eae69ce43671fd3c6c215c7cf42dea102fc6bd90c87dbd4290251129cc19b38ccf00cbdb16dd8de5158601a416b1f00",
+        "ed3012f89d71ed13bb8272ecdc3d0f51e14a37c1ef7757777ada6712784be16ecfd3e6405830f51db33dcb85529293e23e473abf8c5c7655d0c4f152d048bab2",
+        "097a81191e1005676d6e22a96348fa4a7c9561fd4d228eb25f294756bb87a2ba88475b036f79fe373d7540870552001d54795f259239be6d32c487d1944f1fe7",
+        "3fc798e469d39086ba0bb4063e805fdfb2208de499184173f9a2364d56bcd563ed619bb687322425014a1aad3bcf50d22d83a99d09730a92ec6546b3fc40a2c6",
+        "6912b4b341c7dd70683738ba0e7debbabfca5f4fb0760c849776e920750bf13789a6999796234e9e240715b26767782b85a64d680c6d4cd426ad72b2fce081e8",
+        "cecd140150157dc906c0ff7f87c0088f316480783b4fe0a5944510c64a87e3ed066797a27ce9d0f284dca518441808ac18290afdc031294b31aa8b4a9fcd78f8",
+        "2a2bed5d6ac0892811a409d9f1ff6303ccf95544574699cda7f7350301f6d0c4e86e635c80875666e2bb3907510d0e72120f04865edc4c6ceecb4462d6af60fb",
+        "0385ae9b735dc59f304d414ca043749ab51ab665ee01be5e52dcf725ee7dfefea6ad73f335eecf2a5102e88807fdc75ae6dc490d7b8b5f116303ef60a5f17c06",
+        "0ca3ff038965c03bc65bbe2d866ce9e0e4e7d03dc7f86ba5650f82ddb3a9aa846b2b1f553bd89fb4f9b62e3c7faf9ec3109fa90ee56c2463e6efd1abad8e28e6",
+        "6dfd4f22184ed091fd5aba039fcd3db922f5e59bf838c037357fad934b4510603f43a7319fffa62386f8788fdf9ded40c666b4bdca86d9328fe55ad86b372fc8",
+        "a318976102747d800f584df65bfb443b856f009e74f72946d0076cedac04376fab973453adadc310f72081cbba96264ffe2b21a3b18be9d88c4246cba6d30901",
+        "b5e6e4fca0cf9848a00589c65457db68b3253a6e17788541472e1fb94817f804054d07a5d32dfa0cdb6fb44eed50d20e5f2264361132fa5fcfd6e1b367c1be28",
+        "2ea457382925e03cf81110050e636ad678e0aa3cbc6900bdef278aaa18f235e25160a20e23fe0e62a8511b5dd0592f79cbc8eb7dea64ac8667494345c6892dd4",
+        "96b3498bccd78b5a401b2738787d28a98a0edfdc7c0b5ff943cfe1b14e9cf5d9ed43107dfbdd9e9728d5fdd6f71fbc770eaddc4f2e409abe71927bae1f8f73d1",
+        "ce1bfb9afed28af4dc7535adef71b8f1b80a8d7294b411fd1ed393cf232d3a5c5df23dbb1db26dddf6f745f8bc24c3781f2dbbc818a00ae1fb9d6463e95f2986",
+        "e64d37356b296b36930eabe454db11b2097b0c040bed5798878d38a8c4d1c6f3261f36bff764e3b4d606b317e5ff5004184592b0b7ddfb8c2fd8352326cdddb1",
+        "85e6fe54e1e76046af68f5c6044c1e3fff3bfca0baecaef6a1df90350df2b0bec6a420ee8f49ad4464ec4c1e7d71f667614acebdada3df320779078323f6a8af",
+        "b12ff1eb3bab320d7855b549d72b724759916811cbcf3e1a12823f98b64ab5c45941610f6b471e35ff792829dd5ade5179125738f3f23728630f1eec57775a19",
+        "b4dbe72a1e21697a4744be65000cb1bad37ce21416ee6fcea84ebaf12a59c11d7c080df92fb2aa8f1c4ee8e2a22d30be498582d7c5fbba165a472689aff601b6",
+        "348218be4de08dfb245bf25286e36618631d3bdb5827d9f74fa04301661131a4d55c7609b1a6a03b853f0733e0aec02616a0a40e8491f494d76c1543cfc68214",
+        "4287e19bab1d4f75e1d197cbb43f11331307f2f75b8d0d50278eec540999a009c03373529607fda605aa0f0739e20bd1fdaa27d7c0cdc8284d98e6c755a7562e",
+        "08560c9988c8ce5a8876a600b6e512b4e243a4a4300ad5ab2ff0637cc56a0441645b3deb1684064ea43bae1cb62d3bc41537fe8d7deca7172937776bbed793a9",
+        "b536162394776fa7dd5e9fdd01530fda52be1d39bd609b3f3bd0476b8160aa18ab2d37d2991628be2fcc1256cd485525d1fa356b04d30e4a0f9fffc9935cf432",
+        "02abc97175edb47a4cb4bd38d82f86aa099c8b8fa8ab3fe1ce105a22bd616578c6dd1515dfb0397e1d9d0671916de4b522e74e6375236893c8fda6d236bc8da1",
+        "21e1eb731276a835a6ddea7178b23ebc9aecaabc7ccd706587d71b85449793b07e7b179a3da7a571982997e8f5a67f8c93daf11aaa23f07e4df7a13105a54209",
+        "1cc537d3e50ed9fdcdc4f3ccb4819375415304d8e5a6c05805b6b5d9e1fc18256864f10cd812f84801b8616a92b40795a155932464f62dbf6ebd2f9ac3ee2816",
+        "6f6cd26005c8a561cff51e301d1a068fc28b9b650ddd27ae97b522dae9639134d5a150587b0a901f3b9aabc7e39784984cc585235d8e17ce9e3b42105bf9034c",
+        "69c17c2864c3379fafb714c0475e00cf7c9b377d57a8bc9698b4d34a54854176a2f8d15afb54775604787390d60074cd4bca6902ea23d3ae1ac083409fe38a4d",
+        "8669b0ad35829edc2a8a09852b0ee9b3903bf6c1f82f90a3f0ed9524192f1091fd6484e04c3fea8b022f4a8950db17d4734145c0cec5dc387455c126903f7766",
+        "3f35c45d24fcfb4acca651076c08000e279ebbff37a1333ce19fd577202dbd24b58c514e36dd9ba64af4d78eea4e2dd13bc18d798887dd971376bcae0087e17e",
+    ]
+
+
+class BLAKE2bpKeyedTest(HashTest):
+    hash = blake2bp(key = bytearray(range(64)))
+    vectors = [
+        "9d9461073e4eb640a255357b839f394b838c6ff57c9b686a3f76107c1066728f3c9956bd785cbc3bf79dc2ab578c5a0c063b9d9c405848de1dbe821cd05c940a",
+        "ff8e90a37b94623932c59f7559f26035029c376732cb14d41602001cbb73adb79293a2dbda5f60703025144d158e2735529596251c73c0345ca6fccb1fb1e97e",
+        "d6220ca195a0f356a4795e071cee1f5412ecd95d8a5e01d7c2b86750ca53d7f64c29cbb3d289c6f4ecc6c01e3ca9338971170388e3e40228479006d1bbebad51",
+        "30302c3fc999065d10dc982c8feef41bbb6642718f624af6e3eabea083e7fe785340db4b0897efff39cee1dc1eb737cd1eea0fe75384984e7d8f446faa683b80",
+        "32f398a60c1e53f1f81d6d8da2ec1175422d6b2cfa0c0e66d8c4e730b296a4b53e392e39859822a145ae5f1a24c27f55339e2b4b4458e8c5eb19aa14206427aa",
+        "236db933f18a9dbd4e50b729539065bda420df97ac780be43f59103c472e0bcca6d497389786af22ba9430b74d6f74b13f6f949e256a140aa34b47700b100343",
+        "238c9d080285e35435cb53155d9f792ca1bb27de4f9b6c8726e11c028e7b878733549112a328b50e8cd8ba2787217e46b8168d57113dd404d914e29a6a5470e6",
+        "9a021ebd504a97596d0e85048ae1da8999e3a047016f17c6c5556c2731e9b139261f843fad6bd43f7c7c587f698d69b682e568b442ac45889857b7690734cdbb",
+        "3aba07ae980e338637479dca1e352800f4588e62d823365aa69c5b25fce12968d26c9bdbee9a32bffd42e6b22c8138a61c1fce49ffbc190e1e15160153ccb6b4",
+        "774cdf9abb5081fe07eb5725e6069b8d6c7e6004a24d70f7dfabfc03825bbc3b30e620b6041f3cc2896b14ab660af72e249510ac2fe810cc7763a2e5c3fca7fc",
+        "9e089f51657b29c2668e2850524e53aeaaa7306f2ad5a232b5f07f688d8ab2b425df7ea5bd3e9ffd61683890151d78bb94031185aca481e2140fe37985367643",
+        "b35bd54e4f81696b4f22316a1e337d98d1c6b06110998763b5913335923a4076cb80d6d8a518629113477b30a132a6b27fc1ee79f6b2e0d35d5bc29727463db5",
+        "123930d5a4b73b491f50e56e2b7397a43d2e4787237602b66fe0a847bd13cbe8b37dc703d7b2b4eaa8bfb9a58a7d719c908f1966a2f19fe6eb1a78962afa5bf9",
+        "089cbc7ee1b12c0cc9c83ff666fec8026bb71b9084979b0ea8b723bbbe8b00d41008b60499f24f241b63281fe5b4d88966309c0d7e64669105e51e69d7af8ce5",
+        "6b3c678947f61252657c354978c101b2fdd2729ec34927dd5eff0a7c0a865826e833c363232131b10593be1ccf6ba54ecc14312f45bffc2404629ff80267f094",
+        "aa0c23ea1c6fe2e90a7718ef4aa4751ff6beb9d46163595b5d4fb89600525c5b6cf19ecdb2477872a7a12d40e5063608e5f0008e7972a9c01a4be2afe9532f9c",
+        "63347ab4cbb6f28952992c079d18d42001b7f3a9d0fd90b0a4771f6972f0c53289c8aee143294b50c63412585cdce4ff7bed112cd03c9b1df3def0cc320d6b70",
+        "2396c0cb9edaaca9d8b104652cb7f125f193551ae5d7bc9463307c9e69ca7da23a9fbcbcb86669d5ba63438593e132f992b57c0017c86ddb9b47286ef5b68718",
+        "a94b802257fd031ee60f1be184383a76328539f9d8060872ef3573beb6f27368089590edbb21f4d8f181ba662075f91905974beeef1fc5cb9bcfb28aae1e4de3",
+        "52c7d3399a038004bea52d3ea9e91e2544c8652ab8f5285c9d3218637a6d9fcaf0d965b3588ee6d73fa599deca1f41ded8025bf7768e0e200e8cd3ff868c3800",
+        "b629f57162876adb8fa9572eba4e1ecd75a6567308de90dbb8ffde77de8213a4d7f7cb85ae1b71e6457bc4e89c0d9de241b6b9f374b734194db2b26702d7cb7c",
+        "722846ddacaa94fde6632a2dc7dc708bdf98311c9fb63c61e525fd4b0d87b6388b5af7042018ddca065e8a55bbfd68ee61fcd3c6878f5b09bcc27bed61dd93ed",
+        "1ced6a0c789ddb295678ad43a322d896617fde275f138cccfb1326cd3f7609c2aaa5ec102697173e121ae163024f428c982835b4fa6da6d678aeb9ee106a3f6c",
+        "e869148c0545b3580e395afdc745cd243b6b5fe3b67e2943f6f8d9f24ffa40e881756e1c18d92f3ebe84559b57e2ee3a65d9ece04972b35d4c4ebe786c88da62",
+        "dada155e554232b16ecad931cb42e325b586dbf1cbd0ce381445166bd1bfa3324985e77c6f0d512a026e09d4861c3bb8529d7202eac1c0442744d37c7f5ab8af",
+        "2d148c8e8f76faac6f7f01f2039ea02a42d9325794c2c7a00f83f4a7798afba993ff94911e098b001a0bdff4c85a2a6131e0cfe70f1d2e07af0209da7796091f",
+        "99983a759ccf9cacae702dcbfcdf7204ddf0334bc65dad846f831f9f9d8a453f0d24935c4c657fff2ebbdbaf7bce6aacdbb8876f160459b1a4aac95697e00d98",
+        "7e4a02126d7552f4c9b94d80e3cf7b897e0984e406f078135cf456c0d51e1391ff18a88f93122c832cac7d796a6b42519b1db4ead8f49840ceb552336b29de44",
+        "d7e16fd159658ad7ee251e517dce5a29f46fd4b8d319db805fc25aa620350ff423ad8d0537cd2069432ebff29236f8c2a8a04d04b3b48c59a355fcc62d27f8ee",
+        "0d4517d4f1d04730c6916918a04c9e90cca3ac1c63d645978a7f07039f9220647c25c04e85f6e2286d2e35460d0b2c1e25af9d3537ef33fd7fe51e2ba8764b36",
+        "56b72e5137c689b27366fb22c7c67544f6bce576194131c5bfab1cf93c2b51aaa303368aa844d58df0ee5d4e319fcd8effc602cee4351bd2f551430b9211e73c",
+        "f335cc22ffea5aa59cdfc8f50289cc92319b8b14408d7a5aa1232ae23aa1ea7f7748cfef032010f8626d9318edba98d416620335c901ed02eabd276a1b829c9d",
+        "a99a3d10f95b442ffff7c418fa949d4830869b0e60ec8b972c30a3169c27beb5cf330594f014b66b2200a7f086d2c2f3f9fd8532a5718876dfca661ba0f7b36d",
+        "158e2570d084a4869d969343c010860717ff74116188175f2ed74cd578fa0d8091b03fad0c65cf59ab91dd73b37fe3f58a58e7b4479c875acd63ec525812353f",
+        "7c49501c5808b15c0d31bdd5bb5631d53ae00df431025fea51eb4762544efdee978a83508dea6bfd3b931a0e9583ccfc049ea84644705d319fdc5c163bf48224",
+        "fef436b35f717d59aca17e9bf5ffda28f5f401943efe93eb580ffb98f13bea809469a344e782a443c64eb25ad09d8de205fee7d5639686a19e7c42b40f706a08",
+        "4d47a67a5f8e17b722df9858aeb67b9956b45962ec353dc2e27f0f501c398e34397bebe02b54927e2d31f12ecf55e88269fab5370e7fa57035266f89d5c26441",
+        "1b58dc7aac363b00446ea803bcd749c3f5cabeaaf223994c0c3ecc1b28477344d7bf97c08a959d1ac2060b47278986929188ad73de67078ba680963b9d3b12a4",
+        "3c522c843e6974ec750df220d41a004ac2adf09456fa787f7c6543ab17979c777b3e79d1787da5a83f178da9f04cf6f5b255ddcb1874841bbf7016e6132b998a",
+        "5a4feb8f7075b4dc9ca16c6f05cd6b7027485ffed9157d824d9d1a1720eeeeea3f6c125fda4ba4409d798049fd1882c690288f33547a3d8d6260b654548853d7",
+        "bcaa793632569e2f8417cc603253535bd7d85f38531992591e56c1a4b6f58ee7f818fae027888a86284305101ec04661f5995347a467ed8b9279f1acc2b4bb1f",
+        "34af91cc22a69bcb55ddbf7f0f43ec564840433213ea55d9f81ac475208d74851db70fe496af9da1d393ecf878695dd33fd54349a6f824aeed183cb1b08c5485",
+        "b8b7ad2ea2b6fa06d00bcd599c9971c5b4e16558e15212c9bfd373e4bc7917052601ffdb6801be80ba509db82a0b7195929133ad539956065233f49d071c84e4",
+        "dcee9c45bc5d1fe630b18b063ce82c3857e30d20c64b5cc25884943e7ae94edff850eb0e8244023d3d07a8a00706f0582cc102b66c6dda86e8f2df325659886f",
+        "04f6e822f17cc7a5946df80d958aef065d874916e103a6830c6e46b6055918180d1452293c58a9749cbc8f0ac408a9ca895761cfc451164641a179fb5cd8febc",
+        "511fdb7c88268535e97e4ed892f3c065832b265914fc6107a1d27dbb7d51c37e95981506c1147244d5bae90ee90d084984baa7587f41ff6f4ba722c8b92aeb99",
+        "2ba2bd17e926275b0683b236bfe37630266e37f4182f53a98234e915ab64c95996c6cb7ae880c3dfcb47d05aadd21abf8e40b73f40f398dc5b02141457456a09",
+        "9b668d9b4447e376f6c6cfa68dbc79198381ab605f55d5a7ef683bced46f9afd3685411a66e2346f960777d0c922712430e018bfae8653017ea20ecd5f1f956c",
+        "5681024f538588a01b2c8394cae873c6d85d6aa06eddb3a502096fc082bb89cb241531b315750d31bb0b630128d19d11392bcf4b3478d523d7d213e4750f5592",
+        "2aa91ba6de6017f1930fc7d96dccd670748b7eb1d094dfb4b3b1478a612ebf03ddd721279a266de38845e612c93098c2efff34fe500617205b1de2fea1d80246",
+        "824d89c0637ce178b630684c729e26653f34eac7e90412e963d3f19d6451e825852167c48df7cc55b257b250a70c7bccfa9aa15c188ac4637a522289c0876ad4",
+        "87e4ae11da1a2ca8822ae330dc97ab2e47ff62323093c2b7a6c0e2c16821cd7cec92184df4bb6e2b626a4478039063afeeb0d287f24219207898cce7ade0639c",
+        "dd7f2f44a402a01e8216b103a4e7235c2830319d56af639f23c48c2759aba6eb5eeee38c298ebe4198267a00eb2a08d93a503703171c77333862101055bd7ad2",
+        "4cb846596193f7f278aaaac5ccffd5357ab0d1245f6979d141a471bdab55e238b1aed67b73399504b97df1a25eb6fe272b5cd496a7c8a060926e7404fda0790d",
+        "6f44ecdae14e3b81a1912203015f5918eac6fbf4966010f49d2bc2bcefe7b1dfec5c835d7d87a44371f15a6c084252b93465264272a410d50f89a117f31af463",
+        "1f705f6e9f070d87fde8e2774674fa9bf120d288eb0be7aa128dfb5d1011ce1fda99b255226665d83f634e8fcabda9a23c03515e9cfece6e94a8ec92e4edecb7",
+        "2d96c5b01574722b817feb486c5fc98f5f8461f4cee9905af206d4723386d1c4c7cac5840028d7afed0e38ad139628eb6af92b4b88ebf09b1fa047fbe10bc31d",
+        "65da780a0a37479dd8f4d65564f9a7089e4207eb16aca3f65531cfee7625ba1380a497b62472fc7e0007a6b035610416a5f82c1082fa065c46ddee4940d1fc46",
+        "1c09a3b380b8a7fc333fd2714df7129b44a46768bacf0a67a38a47b3ab31f51b0533c2aa2b4b7bbb6ae5edf3dcb0ecc1a283e843f2907b341f179afd8b67da90",
+        "67888b83faafbb622934b8d55963e186153e5951887c7f4a7635c798d9a58294be26a3c549c9fd5986abd19f401ee24eda3602042ad383357a317d38073b38ce",
+        "b4f79963ca31bb62265dd929af7d51272fa6631de7fa35f7a6b03f9fcfdb8e3b5bace33591b7ec2cfab49c91a6db1ff8f6786d08f44e8062d2ff696a7d984142",
+        "408483697bb6f9d011a1f29a23c278a81d37578dcccf423bdf489337f182eab79a50b05f3d2ccc491337c7e41f30793bd27d7661c2e304c946a5a401af8d946f",
+        "eeb5ade1ab97e7154343a46eb4cdd2a773f36301edc6a1bc1dd6480e08f58765cb938782923bc01f8e0c61c6be0dd1ab4c18cb15ed5210112405f1ea8f2e8c4e",
+        "714ad185f1eec43f46b67e992d2d38bc3149e37da7b44748d4d14c161e0878020442149579a865d804b049cd0155ba983378757a1388301bdc0fae2ceaea07dd",
+        "22b8249eaf722964ce424f71a74d038ff9b615fba5c7c22cb62797f5398224c3f072ebc1dacba32fc6f66360b3e1658d0fa0da1ed1c1da662a2037da823a3383",
+        "b8e903e691b992782528f8db964d08e3baafbd08ba60c72aec0c28ec6bfeca4b2ec4c46f22bf621a5d74f75c0d29693e56c5c584f4399e942f3bd8d38613e639",
+        "d5b466ff1fd68cfa8edf0b6802448f302dccdaf56628786b9da0f662fda690266bd40ab6f0bec043f10128b33d05db82d4ab268a4f91ac4286795fc0f7cb485c",
+        "0a1e8c0a8c48b84b71ba0fe56fa056098ca692e92f276e85b33826cd7875fcf88385131b43df74532eaa86cf171f5076e6d17b1c75fba1db001b6e66977cb8d7",
+        "65aa1799143693abd9cb218d9b5ec60c0eddb067e6a32f76796010acb11ad0136ce49f976e74f895042f7cbf13fb73d19dc889d7e903469deb33731f2406b663",
+        "deb712b9cc64f58814860b51fa89ad8a926a6908c796de557f90cfadb0c62c07872f33fe184e5e212a3c5c37317418446efd95613f618a35f7d2789efe0d9660",
+        "b42f4a40b3c88bcecfe328c846bf0648a16990ca539195c0c1dc8d70308067685af677ad65ac0c7a9bcfa8f7acc0aacf45ca18ac831fed644ec3d9283101ffef",
+        "edcf6c81ccf16e11ddf719a33dd0e5349cabac5cfae597009840e1c39362c0f11982fe2c2765859a94262da28dd3373d522693897511eba5e07b8bc6b6064dc0",
+        "46b962d2283694d27975dcbf32564c9b04032b30a93e058fb77b2b718b4ad5fb789ab7d7aa90852da2bfb6b393b09f98e869b16e410e7de230b179f62eb57471",
+        "29036c3f5382e35de7a69fa7a63ec7bdcbc4e0cc5a7b6414cf44bf9a8383efb59723506f0d51ad50ac1eacf704308e8aecb966f6ac941db1cde4b59e84c1ebba",
+        "173f8ab8933eb07cc5fd6e4bcebae1ff35c7879b938a5a1579ea02f383324886c70ed9109de1690b8ee801bc959b21d38117ebb84ab56f88f8a37262002dd98e",
+        "c6afa6a191931fd45c3badba726e68a9bc7388c8cf37adec7c64561cf481fd259a646c8bd843e7709e11e64dcfd5dfffed79235c689b4200fe7ac8dfdaddece0",
+        "a6dccd8c19266488bf77b9f24b9143def1fed61d0c60b5000a523f450da23d74e4e3f6ef04090d1066b6ace85abc0f030173f52817727c4e40432dd34c6ef9f0",
+        "aaf8908d546e4f1e314c00e9d2e8855cb256445aae3eca44238322aec74034a1458a293675dad949408de5554f22d73454f3f0709cbccc85cb053a6f503891a1",
+        "525f4aab9c327d2a6a3c9df81fb7be97ee03e3f7ce33211c47788acd134640dd90ad74992d3dd6ac806350f3babc7fe198a61db32d4ad1d6569ae8413104dea4",
+        "2daccd88719d0a00b52c6eb79e1ca8b4a1b4b44ffa20889f2363ef5c0d737f1f81f50da1caac231d6fcb48895e7299b77af81f0aa4a7618ad24b7aafc8e3a2be",
+        "7d286f1f721ec2d2115ef4ccd82858a4d512211355d4fc58e534bfa59c2e1bf552a96dc4b3e46b012865da88134cf04e731b1930759e158ff620b6ec5aafd012",
+        "21826b9529c4bc519147f5f9fe6db878345215e5094f4e99b131ed54e24953cee9adb718d1743e6c27fc94516a9922fb975a7816b8aab02112608c032bf138e3",
+        "c1689c698ab065f62eee65ddca676baa45b52f308afa804ab4aa6ab84b7ac1aa1dff07175610b12ae11f27b7c430afd57556bd181d02832cd8d0a5fdc3020124",
+        "a1a6281747e34d3ede5e933401747ca7f76628b614c8a394f502562bfee0b994ecb65fbfe1ff7067dcb01d02a92ba462207587cef7dc2cfdb4584848ad55914a",
+        "0070a0190aa696572d853f1d24ab630848ac56ad5c2ebfcfde27d111cd55939c1e4d07872dde7ce78b534b530f0a396e86af9d575354b5d7e34acde18cc767ae",
+        "51b9b5ed193fd4b1a3a92b46bd4bd1f6ec6b38a60f2d0261d72abfd16436128dcbf22c25e3e3c43fe4d29db9124d033330184592d20c5b082c23206454cb3dd7",
+        "578f242746914e36d0d9d4809689571216a43e4733323951620f5ee78ccfee919bf55f287b45a73d4485ac7422879239653b0591c36c866941f8affe4ae56e9e",
+        "947130ef0b948ee04581aba3e2cc4cefc38ccedc861792b7b5dcd9d9361c724a122003bf796ce0979800adabc7456f173ae5269315afc01b606db29c7550e8ca",
+        "c852e677f77b14b585bd102a0f144243059dabec7cb01ffa61df19fce8ab436bf5e2d5c79aa2d7b677f6c375e9343d342e4ff4e3ab001bc7988c3c7a83ccb69f",
+        "01197526917ac2c7bc539519e68bb2798135f6033ed58f5c451e0ce946aff0f98dfdd15101731ac166126eafb5e7cbe2e272ee233f34e5f3f8ea3d2d122482fb",
+        "059c9085895eb718304e2dda78686bd95749815a5ee902510b009af69248b6a7a72ff8a628d81773e11d5a1e7f697a449b7a1e2712d5cfae7ab26507d1112918",
+        "295243bd758cf21c803125fcf321de5f97987c8db3bb3cb51ff97c4cdac9d3bf0a67cee7ed350a41fde6abcc254fbc9f8e6b3e3ccecbd0e4a640a20f362ba3a0",
+        "dd8232d2412cceecb5123191f6e9221e851ecce0faebf0505f2aeeff8a8c92d41dacf177bdae27763ea4a86205ef7634f7a687cc44bbbbdeee5e11e65f9fbd69",
+        "b046b683716d31c914c70b10f7646da31efab2236347459cf8fa2c09123431f72807f11d867c3770b1f061d56ca0e5b1e88a6b44a33cf93e18bcc9cebba5ade7",
+        "20e5a255058be51e1a629b4ebf81e5cbe0781cb67ca4e57ba86b308896bce73820eb08431ce8c9bc5810cc8d8b9c9d6fcf834e42ea33ef73cec47d713b6d8dfd",
+        "1e4804f9c0b1e82b9ed363bde44728acf7d090a1bfe2ddf8819d6592ef453b835bd2efe8b0206e29255b07fb90c7d30d2c114800b86cb0e3e07d387e98ce9537",
+        "41c953d8d22a86c3634df422b6de4a4f149666be8c4f581b2623ee65c392a5c32836639ef56b93686220f45ce65b4fa8589c9125641790b6925faad948b8be04",
+        "8bfca4c8dfe3fde4257b75c3db01862ed31167de66c2e03a2556c4f46c9dffc1ac45f7bc59a67ab93624beb86ddd0d02603f0dcd0364f0f808819be96cd8d3b6",
+        "f6bf59d8d45a557111a236cbba52619ae3dfcc4316943843afd1281b28214a4a5e851ef8c54f505e3c4b600effbebb3eac17087f2227581263f17d7e5f68ea83",
+        "1bc9ede4d41a4df6e8e6f47c2f4ad87337b69b19f710f766e1faf5aa05a43b6645396e7fbef43bb7795d39407b5815b92ecc23a6c1241421153a55d51f12bfd8",
+        "76b38b3631555dbcfb21218ff9e412a229889ef2ce8ad705e90f96aabbd5be7e5329a426534c815a5653771318726641424e3b88292fb1d89544406ade9bccb5",
+        "e53f600740224e4d10d31d2438003143afdb436eb1791b150de35676f0e32f80b0b65f0acf481a5fbf9596c0cb0a27c7afc11d1e2c4d5402475e4ffcc1cda811",
+        "6206b91fc0b6f1211e9fdecdc9d51a6f1eee6554b138adcd4a823df00ddef6759a9bfd7a4e981e045236838f4af693f69377931484b3e81e3e3bc2cb7ef79fe9",
+        "76fd02dadd963bc035399146ce42988cc099d3cf4d32df5c0bbf64101246b1c708d167e29595d11d09b3f63486b40526ac1dfe31bc22dec70b745e90e2eaaf5a",
+        "f0a1fbe31163e421015072183d68ee5191a99cfda169ba5a1954c9f3107d4eca063e137a7114d397c9db672b9f478d41c34e991b0669a951539290c8ed65e46a",
+        "13c72a6aa571b143dccf45adcd98eae699a154b110f25e7e9e82b765b9a08923688e8e0ff311a68a771e145096d60776c6d6ee70ad6f69fa2b7677634055a00e",
+        "0e062bfe818ee10f33481dea43028b2cfbb49ec95e0f75a9e16d404bc519b9ad50b4a733692ca54efb680469ed83ddefbdddb139042e0e1c09c3eb7903fa08df",
+        "453be4aab9f423b33652a0b5d02a9af855dd0d42dd83110ba3bc4b3994ea3f885a71308975089b4903e2e4d6ba6dc2e84031ffe9c8563975c8616aca0742e829",
+        "5361e3e893dd360bcbf51c793ec092a6b052054f5f000b9fce507b6645f8d47013a8706a58d4b10629cc82b8d2d796fdd37b608a587952d6553e01d1af0e04b8",
+        "74b56739f01f8209a40444df4ccdeeea8f97e8e76efa3c04337f69945c4d44c085f1f4789696361e3c97774a935f860d674686dcba3d45ecd8639a64aea0621b",
+        "b4d31587b92b5361cdc2d3c41086c1553e7b55a1f61e94d2bc30bc251daf8a5ebfc50709cc04cbaf4b3b4da2d26b81238fba718fa91759b80bd3103aec11e06f",
+        "aaf6127f00a03d96406b9fb4ac70160db522429b5cd94e7fa0303a749478fe3189c8ea23930a66252a802674dcaf770046820dd964c66f0f54751a72f97d9c35",
+        "2c30d48df9984e02f75a94549217184dd02aad3b57683d09b5a8c2ef53a96afb73feb6f914e2d815bb3b08654332fcfe79f80ec5f051da10d721413ddde8fa60",
+        "92e2c5f75d0ceafc818fa7935939e48b915941ef734d75270eb321ba2080ef6d255e90ef96c64cff1d8c18f33c2eab107fef53e0d8bb160516807480fcba5373",
+        "6e03a91e20444627e3d2e22226cf470026694434ed6479828cb6dc8f27960aeee2f4ab872a5ca2f7f652f7dc77d5f96d85828b8f9c2d6c239e797724a13131b1",
+        "ba432db0a331bb8c39b17bee34462b26ddb7ad91b6c75aec2765fbae3a0e60ec546d45f8e58437b9d77c3d2e8d7ce06973156651d408222aa290cb58cabc0ae5",
+        "83a01e23ab277b1fc28cd8bb8da7e94c70f1dee32d1955cee250ee58419a1fee10a8991797ce3d209380ca9f989339e2d8a81c67d737d8288c7fae4602834a8b",
+        "0ea32172cc191dfc131cd88aa03ff4185c0bfa7b19111219eecb45b0ff604d3edb00550abba111522b77ae61c9a8d6e94fca9d96c38d6b7cce2752f0d0c37e78",
+        "54add6552b08858b23d6645f6ce79e92f38b66ae918677e6d91f7187c4160524dfa8d01f00ea93dd299f3cc40901bd3327a0f18ccd7b6b8e4e47cd28cf838fab",
+        "ef84746dc20156b66ba5c78a50830abd2aef90e667b97eb52291bc869d8aa24559a142c68fea2ef32af22dfcea4c90b3d4908cc9ea5cfc4e91bf11ce6a7e5761",
+        "5a1bf381a04119f942e463aba2b1643882468aecc1b1aa1e7bcaab3b478fc5f056f10da9037d40fa7f55708e103bda965e920cf67ce3adf7e200e861014decc6",
+        "acf78aa3284596f330b7e84751b94c314cd8363627ba997881308578873759895d13dfffa5e574501361f043c74f57d2d0f15c7a41c7c45e3c09ad89d699a977",
+        "18b3e9043844d4f3a2d021f54c38facc364f84ba1058f21009fc371d2e4f38c727518aaba6a29e0fdae6e760a4f1a6d758ebe42c2afc9d2cdc6dd580778c4b32",
+        "1896b2317033cf31046873d87f26e6a42a9d770bbaf6e062df11f9b4a0eab275aab12caac2d3f529eb20d070fd844d86d0a571cdf6285f80e2308bb82c6c5b3b",
+        "8c3dc40194aa021f3c4a1f9a055e4d419eb3a26d4c2f1a8c7e188b7348134080b63f6e570ad11c2878665355419c1020de4b655e7a6c2ccde9072cd427fe8c4e",
+        "70ae0430d545ec427f8541211d4fe042b9823acec04b15c90b7f4b8bdd3dc7851990f370e7141675106649d39151090318231e4ded51225d9a6fa6c424695de2",
+        "07336c42bd51490ef84dfbdfab7466f6b63999a5c08872dfeda0206fda80b9a62de728e3e3c3fd6b7d21a438aad1b8dd223863c0d26aca27790174d9d442a64c",
+        "7926708859e6e2ab68f604da69a9fb5087bb33f4e8d895730e301ab2d7df748b67df0b6b8622e52dd57d8d3ad87d5820d4ecfd24178b2d2b78d64f4fbd387582",
+        "9280f4d1157032ab315c100d636283fbf4fba2fbad0f8bc020721d76bc1c8973ced28871cc907dab60e59756987b0e0f867fa2fe9d9041f2c9618074e44fe5e9",
+        "5530c2d59f144872e987e4e258a7d8c38ce844e2cc2eed940ffc683b498815e53adb1faaf568946122805ac3b8e2fed435fed6162e76f564e586ba464424e885",
+        "da850a2f54e9448917d0dcaa63937b95a4da1eac8af4ddf2113e5c8b0d4db2669af3c2acb0803d05323f3ec55abd33bdf9b2be890ee79e7f3fce4e198696a7a3",
+        "f16095dd9f1eeb77d5b92f4b1fac3a2c5da6ae5d0ab3f254e2a7fe52672411d01cfa6ac05bf39ef65f4b22264b41c3f363563abf0e924290c1c680b18aa65b44",
+        "76d00a09c5bdd39ed32871722cfa0047674bec8d35175af90d7ae9107440a2a0638856d8384c817d772a4a597a895549c84866375631cba042f0ef6ffeb89d44",
+        "a651137b2c47fb7951e7bda71543a6ebc6242acab4347d388be8350f0c3fa3df8d952c7c8a3daf01e06c1da69496bba8de62d86b5093256f77a187b53db03988",
+        "f32f150c2d67c0c437401b70f60b38f0a3a47059033e7505e69a1d301296030bc9b29519c7f8b7d59a71fab90557dc3dc823fac95b9e85e652528cbfb01b1178",
+        "2702566136c492f41089b060108460fa3022c9c25d343bcbd8af2af19c17ef4ca9f2224fe7c4700a10198ee5248f300b548ebf5c8e7116320cc893ff7e231ffb",
+        "ffe6879f46b6292b2196972e3fdf4fe9ea4a816d1807a31caead6aac5f063c8fe877797559a759a00f8ba8f668d8968fb31d8a3b845735902c5e42e289ee0b62",
+        "144884286822c2512d61b046e674d86b264e9cc6893eff36731124f59d1a82001e63f3e8051cfe52e7597e28738e3c3a70f1bed9680e2c0ef3728b10a56ed987",
+        "17c3f146ee8dec3bafcb51c0da37f17871f234c4a0fb7fa6d0707a543e3cbf3adb81e30c1e0ae9e1ace7223bda99bd5919a3cfcc92c6a755e456f093823bd33e",
+        "1b837af233a8a68be70952f783c4961a8152d1e0b0fa325ff086ea5b5f1312b89c42e01b8c3a477cb540c06b2f37ee0e3924d745b4ff5c6af7d61e0e37ac1931",
+        "7897880c1eb00fd2567ae8a59e6482afe17349cf93924a915f8c592693d452075519689dfcd293e376897b3b0e036f114fe81ebcb3153671bd23bc2bed46f9c2",
+        "ca7b6c775d201e5b5a772261de528e475f4bde517660529f41beeb1578b24bcb94b9410f9bf336c109f9d47093a10ba6debe504380d9d15073bdd111c8d129fa",
+        "5718e0d45debc3002d52b22c527329ae5ebf27e8fa9c8feab46c40bc6422ca0335304cf9e7f141de7fa6adb6789bdbf38d14daba3e6297d25bf17de170d6e3c8",
+        "48d0ed249f902841997c255daf99089c9a3124698b164a3028330fdd4cee41e1683fa4d9dc66b2a79c8aa4c8284e27bee2a428a6719d6ec655ed769dcb624e24",
+        "794e0b64ace1fe5ae379937068d82df04868616cae0c17d30572c2024e774894e0668c472d623c903cc5885f1784945110329eb498a895a9e59a75e527158a5c",
+        "2179aa820e03fa33d9bde5568c262e2d3417a402e07a591f9d5570682db5f9bba4bb9d5a82ee5efdb4f65bbbfeee2f4ab9e46cf2ce7e3b054327a718d3f10806",
+        "b0a48c6ada548725799b5986bab4326979609224d897184b8997104e0c6a24b3abe562165422a45d8ac819b99d3756ebbb64f843e3e0934dec487aed12137279",
+        "848d7f2ead41291d0538680c649d07897e45c70a0aa4f9353f82c3f6fbb8e8489c753e90dbe8890041a1aeef84cd3136434f530e9dd9c23fa54fe124eafb72ad",
+        "0ed14626ee6d0c8ed3f0c200c129850fff76318fffa1ddd7dd563a01b7779706862b239959b615ae2ebe27c45037e6ffaf9914da8ff2772ba5ee0811cd9ed532",
+        "5203c07638c4b65f78431e8b02e20f6d683f19fa8f83b5134cd0f4e468c97eacb5267c7d3eab583ccaacd0dba4d58ace52193a5178a7b12d2795f5fde8a37bb9",
+        "48be43d5e0043688df3532f7121afffa167dabe4a484fb75a03af304a5c6f825f36ceccbbbc075eef320c4cd8d7ef8cb49e6dd5973379eec4c233c4543d132ce",
+        "b5464e6abaf5d3d4083d1d7d2a8b0bab78b61709500bbf77823f602d57d513ca9e9fff65efaa899cfe7bf88a0188829c24e498ad00235abe8eefa719fa6ae6f6",
+        "afe5e5e83f19adad9e95903ea9b298107d37dd38632c9590bbffc624d4de958cb6b61af080f037ad17d035b6bf58f780fadf70f3c959668a1b472198a59a8a00",
+        "efa2c7c802e210d2d80fb350b3c2cb3156131811e718eee5c9c6640f87682a55812b10f40310baa7b82b273ef3acc55fede0b5f1949de4293d91b589a2175ff7",
+        "d6c62a618271f3bcbe007924a0c9812f8317445fb6fb19eb589a629f512fb38a0b4e247dea88c56a1baf17883365b436f28446ff66ea43180bd01eb5a6509bd5",
+        "0b41166be62f65e193b3b865e6c47aad260af5fceec9ab44abaa460a0c0246b6c69b67d71d3adfec60dc8e77372f094952344fe10c0d59efec0e11c4a516936d",
+        "79d5f9ffc05ecf337de9f1e0f1d89b30acfebbb88a6935867818cd8d45da3d2518de61a7fe28751b618f7a875e11898fff74157ab90681bd53fa6962671ed99d",
+        "bea983d76f24b1eede1d06714805768faaad4708c9a4ff9cd2422f706b6f0c306d8b67f34089c65ed3880c75f67bbc4d89ad87120a77d0ffe436fb7b58b2ca41",
+        "466fd915efd950bc966578cd92c685929d7b51a63db142c7b9a93d16520495319b87f658e6afda1b42773e2d49da814594a5549089efb1f3ab5f1590ca0a02af",
+        "f64611137ad2954670eaecd626d212cfc5b9f6bb41aaebb1d71e89792eb1317aedc63813fe63de401798df756ca1f22035a0fabd37fb1103437f891ead5e6429",
+        "32e1f938a27faad8ac4a13fd4f6a8bf3dabe4bc72af11c8f0e1a06567ed704b8e78e1140a0c7724e3efb70d23807cf38e627e326afc164cded52b44139ffb3f3",
+        "4833ac92e302ac2b67b02b8827143bada15ced220e1d1f5b71120c51ee54c19d301f2960bdb5a2ce27d441d14af080cb010a8a23eeff5811dfa44d1d7b358b48",
+        "9a0388cee1ad0146177c48b5a08a2db3c489e84ce2aba8c645112a021e411cf829127fa2f1d1ae1baf3a33ea53098477a7d12ba748d2af24d16602e919077623",
+        "e3df0074a93735130d9922d2be916f35343d988ce59d769715a983b4ba807ce1ee70a313e59231584f556ebba1b90b1bb6a6c581a4b47c3ff52189652aab36f5",
+        "9191cf461b6959bec93eae7fb1c6e37073d1a61527ad75d10b7f8949d9b8af70a23ad1312ed51f70f0e9df601ddae238906c0fe3f766b14f113b26bc8542d1d2",
+        "2a8bade272ee7ac643c5e37147faac92c3970bd3862f531e5dcea5ceacd1837453aa498d785b4d1f89e1b2a739ca4a384987302746b4f113424302c4a1e0f9df",
+        "323e6793c7dd9b4d7bb7fbf21531d37f7264532c58f1225548d06e6940c63e91270990e7f5643203c987647e5cf66103e79b714c581bd8772e19d0f005dc8633",
+        "f922076d295d23e2985830aad2f23f652f7f4db42c119ed220a5451488a453f59fa8a2de2303000d6bfd8c4823a85fadb4fb8e7eac122bf01247d76f65247d45",
+        "dc40009560959291558ebe072064ce6712c921b5409b44e04f9a565eeadd39a7716e21b46dd8616517a21a0c03419e94db820a353f152d108384be9470093f89",
+        "7fa4be91ca5207ff087de92f1db09bf71a67878bed193a5c2cc4e35323b8df99a26ecb9888d7b34a739d641a0ecd0a6647a6a06426f3cc1fefdf9069922fae4c",
+        "bad3cd75905d7bfda3322b44a7d3588714d333ee86855a872747e704f6119484bdb7d077fa08edc4a79de0f43fca8d436e8a100857f59bc7b055b987f97ac6b9",
+        "b7dee8e8339db297fdaa3ca5c1dc1988d97f5fb6208c64dea95e1c78f337ce20a2b4df17a7b8236a90d6286733163572c867d93de89ef62fa05dab707ec3a770",
+        "a0f7e93cf32502b9fd79ec20546207f331c5299ecef350d66ea855c87fbddf18e691c20d045a308f83f6cb8fca69d7e2b39b34d2f877276c196bf514bac60270",
+        "6f5093cfc88300bf688e884b4c5ec2c31a8cc28d6331ad7ca71d9760216482052815d44fc69e18a8dc8bd71b31f2b589a7c0780b6199385f8dae6c9b7974c4cb",
+        "3cff46ac3546f65ad7a720871afa20a9216dda5c45188156a5bbedf21546d4bb3940b21a41a39403e3cfd5e7a0e7904da95f4d8e0c5bf5b70eb029556efd497e",
+        "af668a805e6d704b1e581f1e8e3c00cf4cf3e546147c406d17ca974d19a014c78b44e72ddeeb652607e86d690259dcab0dda81c77c7ee2721e82bbb13943071d",
+        "79ddeb5c54ded1e4484071c46bb42802d23b3a08c12311be363c7c7a025a1764c8d85069fda8d517777d8dd809e3d4a956041a7079f9167b0fe9712e5f1229f5",
+        "998e82f4263d53aedac939ebb6eb8b1969746cb815bd721f17a48bee9ecff2fe598c539c419a60e0d5a04f1cb523a2fd0538bb178e44758d3159ab9e028401a3",
+        "3396cfd5cde14aec1aaed3e12252cfd6e342ed255e8e9e1be10f1f273877f3633381e3c961e67ec41e8f9e16110fc03dde88bfc096fc1514461d70d0bece0af6",
+        "777d9dc55a2f57a46ea06a2f4cb9760d00d7a862d0a2aa19467b570f7c7d5ea7629a95eb200e1f9db06610cf8e30d5e6ad0a7b632977fc21bb178967f3b0e09b",
+        "32ee357fc91636a855ba01a0b8da6f3553b1d520adcfe8fe9debccb26c5c4ce8505bb1efb5ed5baa4c5245b50d74463f0767b2c783c47a93b0fda66895693ce6",
+        "340c0a7ce496febda13fa2407a21dc19839bedae1a086ad0fed3917df9bf40944a787f641e90ddbae03a9337723e51668fb893772c0fbdb3eb7ef790dfcbb9ab",
+        "d86a5baa3365abd8f442cd6ebb93113819f0b46061e13404efaa1a58e1ff272ad4bfd30815add88ad98fce9af018374ca60d89790f71a6075f3d68d32021a9eb",
+        "a67e6ec657c95eab3c3c32e41fbf39cf2033ab4be2e2b821104adbe69d16e948dce4c4c6a3cf2276901f7d4ffd69654649882c014d2c10a1302b79c61569cd36",
+        "55ce192ae4b3eaf855590e2d44e625d9ba146eb75048e6b56e025031efba0bda8aaafa0470b7ac3d406e5aba3e832f27a507246d1b5f33dea1f724e2b81b0c98",
+        "b3a20c1fb0b4f0d37726c23b5877dd8e72f69886e09a8c68cfc301d2a3f2f95cefcfabb8889903c732f4e81432d3f678ccdfc398acd8a2f06641100450d89f32",
+        "f7272d93c7012d38b27f0c9ae2017958bba666a9de1e8812e97437aeb2e03c999438f0be333d09addbcfaac7aa73f7b6ccec67dc077998dedb8c1332bac0fba8",
+        "1fe7b3de34c0479ca8405f3cbcd2db64bb18dbb291a5feaa16c5228c93ee21c711d68a010c2ae88005ebac959e3a322452f862dde94bb941813e524d2347feee",
+        "4ee1d38805c32284ecebe92e3df6cd98c7d6680eab0d68664f96706c45633b1e268222aa5a5279ef01fc285432abeed74ba3df189f50a989d58e7130622daa59",
+        "0e1405871c87a5ea408342f39d3494f939f73c2260c2a43a5c9f1b57330cca4093fc1f42f96d83005677037db51aef26f05438057ae79ed14464fd8e57d15586",
+        "17c5cab4091073621b5c24c336316d0cf649ba1effebfc87e0439cdf578887b221656d339a6fd198abaee67ea188dd66567823fc220c52b57490251469d25d8c",
+        "57dc2797d142681c94fe488626986ed4b26703cbf6bfe59391643657065b2d46e4b1ddb3aa832c9bd449755ac8b1bf936897fbc6ade378f2bd6493e486f42029",
+        "4412dd6bed6db2a803c2e0df8f5829e7a4b0417889510df7dfee49574a71ec0d9e0d46065017c72dd9743933ca839a768dd15ab0b7c14c626a354109690196ae",
+        "d0ebc771031b7c160021c9b6fbb2b670e3b40270026907a39163db1873ecc3b800111dd7bf138f83a610dc046da268b72b8c9086922377dbed73948243ca1e14",
+        "10c4ba315591698dfb91a57337631884b4738d9f59807851a679840cc287ace3011ccdc8f4a485bb1973404ef9ee9b9cf1eadbc54074c6d113de8fc91d0797eb",
+        "1464347be32c7959172b7472d11fe07844a52e2d3b2d058cc6bcc0a8a275d6b82b2d6263755eaf2a6588b6a1eb799af83a4ce753f8c75a2284d0285bab5f7c1c",
+        "f409231ed187f5c4e833fa9e3042aca6c858b08b496b2531f84fd5cea93ecd06dafe0a10c3ff2376c74dc80da07da01864fbf2685960b540b3a2e942cb8d909f",
+        "395132c580c355b5b0e235336c8dc1085e595964043d389e081efe485ba4c63772db8d7e0f186c50982e1223ea785adc740b0cf218707458b8b8034042f923c2",
+        "f92abaca213229660649ef2d8f88115b5bed8ab5b9bca9a1b4c52457035310c41a6bea2b23b7918b5b8bf38b52eac6ff3b6213a522f381be7ff0906dba7bd00c",
+        "cbade7ad3b5dee0ff1a46b082cf4e1e1dc21620dd2cc0edc2c707a2162d2149969abbb29c5720b04bd1568a9556195e67f24322dd9aa4e8365191aa5b6c44579",
+        "f51b4ae4d4c54a29cf7135a8fe1eabd5e1bcbf820896967dc41e3849dac22507694210ca11c4ebf1c29a8d4f71b30f76c9b6010ad95bdfb0de837925f0612597",
+        "ce3872115d833b3456ca942e6e385f28a903beabfb753f8afccc12f2582ce1f36212bd05e05a46fc88d31950b4911ae5dcd8ff7a0b50474cb488ccf2a89cd0eb",
+        "9bb74cbd47a624cbeafcc16d462947bbea1370b85c961a407df9863e54e6d9e6a8d2ef0c6497205e5eb7c3e59e698d992463ca9dd4cf28cf9a2d4e30c133e855",
+        "729633820bf013d9d2bd373ccac7bc9f3716f69e16a44e949c7a9a93dca126bb1aa54e5e7040707f02876afd020af472639d49f5420d294c3aa31d067e3e8575",
+        "06861db307c678086e8b2aecdf1829d2883d28b731abd0f1e72f1ced6c7ad4172eca6322a83fb6a65afa37e94a3e2ba205b87bf382d91588497a4650883bd875",
+        "356eceaf1702b370f4aab8ea828486f33013f744b39e7ea26c6918d60e1abcf44fb16edca7720acfc6a701bf1e2c35ddbd695a8d408e8c9632e8cd27230cad8d",
+        "489a39d0fc3cdeaf42892ed80385c11ce293c932215bb23188692a86e61bcad92c2a1d1142601b1bdf0982d1cd1e05c052de819e64f247db35915dd1db79a3b5",
+        "c02f464b4dd18117e30a8db8ef1da067134b604efa1951767ee632dc024d64c00f2449f042db3aea0174ebcdbb4ff59dae754f723946f1b90a77fd9523690b7b",
+        "fb31e6ddb86dbff372646d1e3a3f31dd61159fc393658c2ee957103bf2116bdef82c33e869f3c83ac3c2f6380cf692f7b1dcbae0bb227ad347e754137466c69f",
+        "006062abe16c2fe79af88085e0b582b106e7f79f01a43946c78b19f9bdd725997636a332eb9a3aaa6de0d4a8e9e28e8c778774224c665bf7bc3644fce411228c",
+        "d44a6db3de9fd4e4a7ef155a01bccb91c1bcf1cb53225689a77a0d23b4d39a89a189f28980f91c56eac5879eae933ced7f267e2f7040eb380fdbbf34a6b7b615",
+        "5afbfea1deda5aeab92e4d0c31d16a9a86bf7c7523274a05c50529f5c139db10933a52c6229cd31108f083fb0c85cf52831b5a05f2550a77b5703cc668912dbc",
+        "d17fcad4e0d8bde2edfda168ba47104bbca4d26da2d31a070b0fba0b26eedd95eec1fc34d76cd4a1cb15f2621688a9cc0e96358de993222bb3e3cd0bfdcb746c",
+        "bd6a59216337b45d6b71aeac01366bfe9660e0fbc2959adbb68d526c43d48ffffe2ffc430588e78e66546a3c709b0acea17cbc5a218c53cd47aa4871c1dd984a",
+        "83ea5ae1891145c41a7c6c87fe922487f5d282933569b7ae0e345653381ede6d4b16e144d1c3e8f0605daa0db5965a7b79d91a8afe11f1e0bc549ac074a01ab7",
+        "375050cf2e430d0e29875835208e8906d7052e47292c5a38a63082873d31d583135c07a20c52d95b2d5dc3eade6be143ca3438f44d020aae160ed77ab9884f7d",
+        "3028b0e824957ff3b305e97ff592aa8ef29b3bec1dc47b76133d103ffe3871bf0512a231afcb1df86597ec5e46e923c8b985c2850857c64001b2c551ea833d0e",
+        "087ccb1e5bd17222b8af206dd63908f8917297621a8cb9330ae0ba4af3e9d60c98fcf1effcec20136b4f9188126dfa044e1c1ccda3ced87373d9379ccbedbdb3",
+        "7f17062498bfa2bb5856cd0a62c568c5c6b897432474efb2e6a2ee18caffd21e1ef30d064723850f7990d21ba34e8f2b3bb067023a772782158a27c6c467c928",
+        "6ba986a942497fd38462972f50a61968c0652dac56ce9b9ac1bc061ab634fe5a77acd0275f8396e3c0bef012ae93b72758b8d7679c87e847e63017b55a69c5c6",
+        "967c81f561951833fa566f6b36077eadb2a615cc15f0edbbae4f844ddc8e9c1fb83d31a93fcb1774d740d69208ca5930bcfac4a1f944469fefd19b6e9375e0b5",
+        "e8aef178e6da3ef5caed6530f7eb25608256c2377c4cf96b0cfd0d76eeb4bb86eeff7b7df1585c8d7a20c0633a67907f6d2867c3264a91c051abae6eea5a91d8",
+        "6481dcc8157ae628b5cd526bac8f933156dedac956a2b22a974bf5f7ec2db5806f53dd0e2dd53db87cd8f58a586f9b3c5c522331a31174c4e7b9b6f7f057c28f",
+        "a71ea45ce6616a3d2f0a592d5d0286932da63c6db11d59c6691c35a56f7ee4f80b6fc340b4dbc1844c5040e668d2892f4a4ae8533f1b6771bcfce7c3a23e0d97",
+        "9693448770feae421726eb203b01c70823d5f44cc5213e6a68284729bd117d9bd18fec4a0a824a24080f298bacd296d7b497838fbd7b0d575c52492b3e6f926b",
+        "37a15066f2b9f94c24611bc453ed0274078d1f70b2d34c8b963608489dcbe8df448edd9c73362bb2b66beef61fce60106f7019ed373c692259d9556a940b1a06",
+        "bd44e739e1f9db1c6baf42ca4a12ac099b96f6b36c4bcb1b72eeff08a6496835ec65150be8fe16cbe32707e347547dc5a583d265746fa595c5e7730fcf24581e",
+        "fab2038e9498a1c39e0578a0a5ea6b44f3c1b41ae567f9914a95b131c48d121ecacea895a09b1d4e0442bec9c50c50e00a9fafeffae070884c2625a8b1a21726",
+        "05a1b76b2fd56211e0f2d75a251654a772f55e18ca022af52cb330191e98a3b8eb87e5117bae58044d944c1f1885451225417735fc72f73936693cff45469f8c",
+        "2a30c96bdac78a3994eecaa5a53f827f58e13231a0d113086c06b1bdabda38d08f1ae27de25fd22eea70c05f0132bf7a501c82ae6215bfef3c016398baf2cb62",
+        "48db53765b82bd6f2533eae17f6769d7a4e3b24374601cdd8ec0ca3aab3093fd2b992438460baf8da58fb9a89b2c58f968e63617cbeb1844b02d6a27c5b4ad41",
+        "5c8b2e0e1b5c8f457d7f7bd9f05a97e58dda1d28db9f34d1ce732528f968bedd9e1cc9352d0a5df6672928bdd3ea6f5cb06077cf3ad3a76e29b22e82bac67b61",
+        "5b7391aa52f276fab9c13877f12232708497fc028faa1732a5db079e7fe073ed0cc9529cfc863a4ecba4dc2f1ea9f6bd6904f3a0c107193c5e711cb911f38025",
+        "1d5af70f09a5fc6916ef59a38a86926dcaae39a8954d73fc80a350751adda38c9d597506dc05e1ed37bd2db1590f99aa296aea13ab8443d5a92347fb85fc816d",
+        "80e3709297d44114b9fbdf5567f05f330094cf09f4c0efcfac05095c3608107730c1aa07ff23002562c7e841a9f56624ffe2abec611eb9e73e1ccbd8f62b1149",
+        "f9945c190677846194132b496ec6012c08750e025fd552ed324d3a49d86366c03dccde8d5b5ac9a4bcb7195e63bcaa939e8eda18f11694b6fa6937393bffdbf4",
+        "8d8f2ed9ae39809aacad2fcedbd2dca730c783e62ff70b8d3c5362f073f83467197d3756b445195fe752117364d92cf42c026e409d5ff7a9533eab78f1754a2d",
+        "3ac99ac53ac49a56faa18646b8e08a2d35be80df3efbbba6bda4ae902b8d3e170a7be8605c34a4dc9a7362b1c201d702391bd7d5207f95fa390ce33c4314d411",
+        "e4694bdb31016f25532c043c5c6308cc619b0f8716f0c29eeb9f340f47b07b4a4ce0984c4724b12ab3d32af516ada2644ca6558c1cb5815c1212a9b5fa834412",
+        "c63c703e62108aa0edc683f3678a00788fb100c0960b4e98b76a48e4e5923d3413448db8875e3bcea7b6b85d9e3eeab72cd15096fbbb2cc4270317fc34d40471",
+        "9080b7e841ef519c5417e690aaf4327907a83dbcb738d0f7308b1d611def169a4f47423e690f27a7e2741ae7865da23c5d3f13c316063c7aa1a958e5be838f04",
+        "298df646915f04d665e9675e6a1031870d28eb7a0405663eac3b10d1b4fa2e868e6373a586cd73e06d8e7ad771b4fb0a8b4fc2dc6ce09c642ee89926fdc65260",
+        "4f2de9c4f4348bdb323a668372e7714299c776f9602f3af8fb7746f176868df3542b2fa69eae38b6a26a06ca8942f88278c64e3d017fee67a94ea023b2b5be5f",
+        "4018c5ee9093a681112f4ce193a1d65e0548725f96ae315387cd765c2b9c3068ae4cbe5cd5402c11c55a9d785ffdfc2bde6e7acf19617475dae0eb014456ce45",
+        "6fce6675e86d7e85704c96c295703cd95498590e50764d23d7a7a3a32268a0b3c991e8f78487699a554b581e339c09aec982e0baa4318793620635e1e2c8d9f2",
+        "eba937859197c7fd412dbc9afc0d67cc198160b5a9ccee87c41a8664859f3efd961366a809c7c6bc6fa844926814e0b4efa37ede2c8844268d7f3556e446581d",
+        "83f433e4f1c50797493c58c264cffa70c4a7a24c334dbaa3c57489d970d49d6949fe45b704f265efd2aee1ac1b46f4aa3e4fad68b37961d2c7280ae19672c850",
+        "b557ece12272493dc27e88a05adcd861875a0cd00bd68adc3a301d263a9cd993a96ae14cfcddcb997cc98623935050ea43552a341107187de75c4eded7c786bd",
+        "9589c0813b7393dbaaafe47af5b408b23c8a8c8bac62554b8fa132a358ce3083b1d4e39707cd54a55f673d48116eb1f9ed8de9c943cd2de460a68bddf71e9803",
+        "ae4ccf27ab00a40c3637d3d2ce51a83efba62d4a6fdad695063fbc60a2d82ec5a54acbe09ba9388f49aac27c992d84632036e1bdd4c529bbf1851eae0c6ea902",
+        "a3944b2c31cb494080b7ee1db0816853e425b54c48d631447ea52c1d2952079bd88fab9ed0b7d8c0baaf0c4eca1910db6f98534f0d42e5ebb6c0a75ef0d8b2c0",
+        "cfa1a224685a5fb2010458201ceb0cda21c82b1602dc413585fbce80976f061c235b1367712498144ac16a9854f6fb323cbeb62369cf9b752b9252a2a7ace1fd",
+        "fa62c6cfc8f079e58f3d3fefd7c224e71ebc69a95b1835ccc32f350777051102615492d67fb6de62cf2ad5b18467fe8715748882db89ff86efdf2f96f8135ed2",
+        "cc633fd4ea6ac408c3875756b901288a1de191892832be2e9026dc65c2ff00009f1436ddff4206260a3d66ef6192143e572f1e4bb8e5a74b12055e42411c18bc",
+        "44d2bf7f3696b8933f255b9be1a4a6ae3316c25d0395f590b9b9898f127e40d3f4124d7bdbc8725f00b0d28150ff05b4a79e5e04e34a47e9087b3f79d413ab7f",
+        "96fbcbb60bd313b8845033e5bc058a38027438572d7e7957f3684f6268aadd3ad08d21767ed6878685331ba98571487e12470aad669326716e46667f69f8d7e8",
+    ]
+
+
+class BLAKE2spTest(HashTest):
+    hash = blake2sp()
+
+    def test_constructor(self):
+        self.assertRaises(ValueError, blake2sp, digest_size = 0)
+        self.assertRaises(ValueError, blake2sp, digest_size = 33)
+        self.assertRaises(ValueError, blake2sp, key = b'x'*33)
+        self.assertRaises(ValueError, blake2sp, salt = b'x'*9)
+        self.assertRaises(ValueError, blake2sp, person = b'x'*9)
+        self.assertRaises(TypeError,  blake2sp, fanout = 8)
+        # Must not raise:
+        blake2sp(digest_size=1)
+        blake2sp(digest_size=32)
+        blake2sp(key=b'x'*32, salt=b'x'*8, person=b'x'*8)
+
+    def test_digest_size(self):
+        self.assertEqual(self.hash.digest_size, 32)
+
+    def test_block_size(self):
+        self.assertEqual(self.hash.block_size, 64)
+
+    def test_update_chunks(self):
+        """
+        Checks that data spanning several 8-block stripes
+        gives the same digest however it is split.
+        """
+        data = bytearray(range(256)) * 10
+        digest = "70aef6d0ba6e8a15c9cdb55e60a8489c5bec5bf7708e1bda4bd32cb4c7b2c713"
+        self.assertEqual(blake2sp(data).hexdigest(), digest)
+        for size in (1, 100, 64, 511, 512, 513, 2048):
+            h = blake2sp()
+            for i in range(0, len(data), size):
+                h.update(data[i:i+size])
+            self.assertEqual(h.hexdigest(), digest)
+
+    def test_update_large(self):
+        """
+        Checks that updates large enough to be split between threads
+        give the same digest as small ones. Threads are used only if
+        there's a CPU for each leaf, unless built with THREADS_MINCPUS=1
+        (the threads tox environment).
+        """
+        data = bytearray(range(256)) * 8193
+        for prefix in (0, 1, 100):
+            h = blake2sp(key=b'key')
+            h.update(data[:prefix])
+            h.update(data[prefix:])
+            g = blake2sp(key=b'key')
+            for i in range(0, len(data), 65536):
+                g.update(data[i:i+65536])
+            self.assertEqual(h.digest(), g.digest())
+
+    def test_update_threads(self):
+        """
+        Checks that updates split between threads on any host give the
+        same digest as sequential ones.
+        """
+        data = bytearray(range(256)) * 300
+        expected = blake2sp(data, key=b'key').digest()
+        old = set_threads_minsize(4096, mincpus=1)
+        try:
+            for prefix in (0, 1, 100):
+                h = blake2sp(key=b'key')
+                h.update(data[:prefix])
+                h.update(data[prefix:])
+                self.assertEqual(h.digest(), expected)
+        finally:
+            set_threads_minsize(*old)
+        self.assertEqual(set_threads_minsize(*old), old)
+
+    vectors = [
+        "dd0e891776933f43c7d032b08a917e25741f8aa9a12c12e1cac8801500f2ca4f",
+        "a6b9eecc25227ad788c99d3f236debc8da408849e9a5178978727a81457f7239",
+        "dacadece7a8e6bf3abfe324ca695436984b8195d29f6bbd896e41e18e21c9145",
+        "ed14413b40da689f1f7fed2b08dff45b8092db5ec2c3610e02724d202f423c46",
+        "9b8a527b5272250a1ec397388f040914954806e794db04b70a4611bc59586a83",
+        "2bb6333729000be3d5a21b98f8e7ead077f151a5393919eb67c876ee00bbbb04",
+        "63c01408154ad19d7fb739f311781780462cf2eecce60f064e853487c272e3eb",
+        "3d051a1176019ca37bf33d60427f8d9d1c3abd598297cfb4235f747d7c7c7fec",
+        "391ea912df4d4d79a4646d9da2549a446d2240f62415d070a2e093992b471fba",
+        "324640440ea5c3082ddc309e7809d741d6cc1b2d490ff8c052128a6eeb409d62",
+        "ab855e6fa39a5e8fc90eacb999c7f78ae71e59c3d97d60afe517d587923b7711",
+        "2a39da4586efc47785a7a8da85683a51724cdef5413b356dc4fb500513f8fa2e",
+        "8a0057c1f78ad6214555c0670733e29a4c7e956227660efeb1d7fc79f58ec6f2",
+        "0764b0017f5bd951f01d9fdf95c0cb4138985d84799cd42984e25b512800e73c",
+        "cc02495693c8e184ad2ed09d533dc33b76a7783d6207fcaccb64f3ed2c6d66e0",
+        "c0df49c206a34288143216847df334d4569dad73c2b1ff6284884fd38941fb95",
+        "b9194519e4978a9dc893b28bd808cdfabb1bd510d862b3171ff6e017a41b804c",
+        "bba927acf11bebd362a3a3eb78c4bb65e602a8709fcef38dc6c8b7bda664c32c",
+        "ecb4900a63924e720d40f2d2b14d1bb39c3701ad7346bd0b67234270bfbe7e70",
+        "f8315a21b25e6ba8bf59b17b05913b8ca4659f1cd838fcc773c9eb12e7004e09",
+        "4b77af67a9232bf1184e57818294031e55f1f853c94dbab5577547330d65aa61",
+        "768568390fd2b87094114ed4cf723ea320fe977b53180305c384335479f0b59b",
+        "a431cb270f3e2c9b7a9593b155ccecff5b5c4a2dcd5d6bb1c485aa286997f915",
+        "d691fa6a790b1a517980087f50b03ded8c6ed486d084221c827d9bd922beb8c0",
+        "8f978a4932f4459813e8fe15686e4efa25c2c5ff5a3a4f8c9b14965d2f0be461",
+        "1efbd0c131449142f2295f2d42411dfe0f48d4acae762d8df67a570bf7b1dcd5",
+        "d53ba93346143ab8e0d3d1bf272706d169e66c69c7b8f4a5e82fef440702bcf2",
+        "f71a3ec01aa382ea76992b430a7f42c7ad2a86aea9c19e76cd1732ec6830de6f",
+        "80a6ab7b710464f93e6cba96864aa6409bcafc1bf4b32a309372e857e804068c",
+        "dbde81e51a52174b1014901b53bef88de93b29e274347e8e9a7b037456629f35",
+        "75f274466b1a2d0fd845bbb57c38c989516e1568320ab517b163eaf709234cc7",
+        "afe1a0591c491d416eb64f6286f3ba29d4c9998214a3831c39014ac030557945",
+        "67ff6acdbe8a99a166a5d9cf32136506b548d6c947c24c699cea3afd92adfaca",
+        "bfb4d0c7112075262c2dd248f334b2ef1540087ecc7382bc2a272575c5009f70",
+        "17c94b9c537243f2335b863949b2b91c98a6956d7c10aa989959a80f910c2522",
+        "f6338f434d319410196d9519abcaeff7d55439fd2aa5babf7a7e7913b294ed4d",
+        "08ef7d65f9bbf3da1f7884ae9b75901fd85295662a6ea71de08bee3834576278",
+        "1647ecc2ba13f8b93b2fbcdc4e8f1dfa47fe3be12aaa0e459b0e5a87f3a69bb0",
+        "ff927a717881f6fd8ed8bf5d5e35bd80161573e5829404c32d2a276a01f4b906",
+        "c8caf136ff209c82e0240c1e62a3bc7e9cac873b011cf7c5e67ec187a5fbcd96",
+        "d9acc73e3f421e1883b5ed53d82a9aec8f5dc980c42bcaeb0e7d8976a338ef51",
+        "9f173fcf08a5362193f352c8256ae534ae9ce7bfa4bc09fac90098f98a716294",
+        "0a724579dc80bc0c9004e51be7eff3afa53075ab4a32557733586e820fd36423",
+        "38f7c340f4b159b1e594f6eb83284917b7aa19c74f57117a4e08cf7c4e32a23c",
+        "1c674be257e9b33134d4168f152f8b63dfd780c97dc4dc37ac26cc0aefb79c1a",
+        "2f0c597616d5751714a5fb4ebf3c481a96c3ad145ebde06509f3a2e5f2c13fc8",
+        "fddc69e0c983cd8283ed8188bec4e5f41dea3d01b9e74c4baf7341d8b4bf553d",
+        "24d083cba038c87e9acb8681820208b75cb3293a96c9efa75d2c63f16b85fe1e",
+        "7f6a649cca89b253ffbd20c016980100a87c168109628fcc66525d8baafe505f",
+        "6da373b4c18792b3209add15a5074a1d70c10bb39480ca3fe5c439d95fc286ca",
+        "270affa6426f1a515c9b76dfc27d181fc2fd57d082a3ba2c1eef071533a6dfb7",
+        "c22e15cfc5a3d14b64d131f35fb35dd5e6c57dc4afc552277501eca764da74bf",
+        "ad683e96b8ac658c4f3f10ad22d99b07cb5ef9e31cbe11e7f7dc29f2aee5024c",
+        "78d3ceda1ce05293f430f6167b33c99f0b1d6dade52143c2925577c0ba8253eb",
+        "e006456344f90f501c25813f9be2a3f40b9874fa0563981cd456ee8d44807c93",
+        "3908e8d547c0afb1134949466304a145027e6bb7a74dd1c162cdf0bcf77237e8",
+        "1b6c87a34838c7cd5fd08914224e90c22abf5a97b10646d98c4916d3a8939e62",
+        "b0d38f82f248916952b316b6d36d9e022df6eecc26c762a655cf5f0ae649e2bd",
+        "8d66fc9ceda5eddfb1e04d096ca70ef50650fb87cc6a9ffbb3d20bce7b5a6074",
+        "064354e8e11cf713b2c72ba67ac7d76e41ba61db9c2dea522e0bda17cba5e392",
+        "c8ef5f498bd1bc707fbc7b5cbc2dff0493144ac52786db3c793ef4ae8a838847",
+        "8a2397df31e7f0cc290da9a8bbe4f5f7a3a13750730db62dc2540fdbd6188589",
+        "f12d0b13c6adfb3be50a51eb6baf65abfb1700baa87e527dbe3e675a7a994661",
+        "1024c940be7341449b5010522b509f65bbdc1287b455c2bb7f72b2c92fd0d189",
+        "52603b6cbfad4966cb044cb267568385cf35f21e6c45cf30aed19832cb51e9f5",
+        "fff24d3cc729d395daf978b0157306cb495797e6c8dca1731d2f6f81b849baae",
+        "41eee90d47ec2772cd352dfd67e0605fbdfc5fd6d826451e3d064d3828bd3bae",
+        "300b6b36e59f851dddc29bfa93082520cd77c51e007e00d2d78b26f4af961532",
+        "9ef30314834e401c871a2004e38d5ce32ed28e1137f1970f4f4378c73706763d",
+        "3fbdcde7b64304025ec0582609031ec266d50f56835ae0cb72d8cdb4cfaf4419",
+        "e90ead3b982b435b66366a496c3f8ae65b17613700f547673f62153541912864",
+        "abe3547b336d6e240d7fe682d74b9cc7e8d7f9b5664858b94df59e9fc330d9e5",
+        "b299642095b8286c521cdb21ed0fe057278021bb4038eb5a3d79542f5d751f54",
+        "e4d758359f086793a83754aca6968c3e9fd94b40497f2ec224a2916063a214a3",
+        "59a304fc03ab75d557db04ebd02dd4c6b810a138bbfeea5dfceeaa2b75b06491",
+        "3995102215f5fe9210eb30d952d8c919589e7145fcd495ea78d02b9c148faf09",
+        "472ee711563506a5f0083fe82b08b9923cf6c8404d0cbacbf84864f648542ac0",
+        "68fdb82adae79bef590aba62d7ac553212061c36e36f12c0efa29a1762de3b6a",
+        "7585c0773383f174fd666549a8352b305bf6855bc98bea28c391b3c034da5a5a",
+        "acc575fe2cd7ba2a31fc7d670a9234af68503386e959073d16a81b33b922b50e",
+        "9ec7d2995943d39d6b971493b897a0ee2d3392a72db875c2405d357178fb6911",
+        "2d7ef19401425aba450e82d36d0fe7b2085ea0af6045a5994cf431ea59939cc9",
+        "f32fd855f011c718027f2ebe377d6939f12370caff151c1e5ace438d703c6d9f",
+        "b2bd83d2310d3d7b1d2d5aaf4359fae28612962719fdde4ddaf69e7820f33f61",
+        "1a7a9d0f44ddfa7fc2f4770cad7422fa6c4e37e6cb036d899e102750e594ffcd",
+        "dc69f6141c8e103ff61f6298a2c44f52d147366ddbd9c79cc308fe84336a9564",
+        "e34ed417b0791d9a77ee1e50cc2c207e540c77140421c46ce0862878aaeb2709",
+        "2174425c8ccae398c4ff06f848991c5e9bc0f3461111706fb95d0be1c68e4760",
+        "1894582a8a25fe8f847a4a032574b77b8b36bf19997526bb4bc85f3824537feb",
+        "17ed188ae3c953d655445983b8325bafff32e222b2dfeb16e8617abf86ee7cc5",
+        "f1489ad1c354cde9789237ea6dbf67fc1e44d1acc8dc66ad838727f47d9a91fe",
+        "367f22165b8b66e97f6670f34eba2749d2643b21beadadfefea2574b7c9b2196",
+        "3d8dfea17eea5d645ac1d41a5b59226c486c36bd77ed44bb349170d080e30e68",
+        "4115f89e0b3b5c8f6122c02500171dcffbcea4662a8c5f8c1c01a9ca7b1027bb",
+        "ed6e910b960255d7d792ebe67f260a143cfac1051dfc059025ee0c1bfcbc5681",
+        "558fa8afa12bbee54af78f6b7445f99665d4e356bc07d3effd8fd65ab9c74716",
+        "5b6012762053b8734af0e555e6a2bb4fd4840af3b04fcf6350a2b8a51b6796ad",
+        "ab7acca5d77710bad37ba0ff4ceae27e847179f7fd7aec8869c649b33f8d2577",
+        "ff7730b474ec2145a92dd1cffe45c342c6fd6bac580ff95a75eda3bf90eb4f01",
+        "d10f061d5b9cb44ee078a96b3318579e5ef50aef3ed96e4f62149b2e9f7c660c",
+        "67d22b8edf2001d86422136ac6516cf39f7fc6a7029892fd75c98790964a720b",
+        "7a5ec5ba76259b07b4da03f381fe7bea4865c86c424abaa0dd1ecf74f87d2ac0",
+        "e0ff60d69029e6bd1c15953e91509c0c59ed5da5000199f216d29f96079c2fef",
+        "fc13ead841018f59903b40f2020c6638a66a54c3a338414d97a5c394f3266f33",
+        "0c2f62b898fb2f63617e787345263cb9cf60654b553b203ee49dcbb8f2a6afac",
+        "d7d6cb552aeb36eb96b1d5e052f8d921c3245a970d0bc8410cd65ea104c8e779",
+        "b7141f305efdfee556bd13e0400d1e8cfd6548bf81ee5d15327e4995ca8ad6fd",
+        "b6b638d22b7a12825374f70348d7448d4e7d908cf6e7bbef8c93ef679b2a5478",
+        "0df4585641fa09f6cba4cc165a10adde34f80d425a70db67e2fd237b627f438a",
+        "106b2b354d95acecd0d9588fbc231f8bea2e94ea662ddd3f139e1b6787461eed",
+        "ae5c69eefe9089b29c6c1a2370d20552ba40c3d5e3713c12defcae997f433ecd",
+        "1aaef55d4fa892b635fb2a7a25f9a8e03b9ffb082ae9c07c2042a049c6515e45",
+        "297daac4d54dc41c83e32394599f171cdaa9ddb71726da4ece3ccf95c11f56df",
+        "2c45acf491ec2f4b7e309e7edd815be5a54c4458d1a57c4f9b763b0c6718d43e",
+        "2f92f90170d3ae95abfac3a6989a2a60cb28b858782be7ea179b48a7276dd860",
+        "b401e84b15acc470936d6e37f7888333092731133b251bea221658ca19a75669",
+        "f8b340d2b9b33d43a0a66f3497820afaaee434c4e3c0c17e898b8301c57a26bd",
+        "566da283990389138aa6f2aaa3b9e40cbf90840ec762bd96b7e33a3113b10108",
+        "340672b704676042c9bf3f337ba79f11336aebb5ec5d31df54eb6ad3b0430442",
+        "5050b73b9316eea2f149bffd22aee384dc5403b18e16fa88825e181609496fd2",
+        "1365cc6fb9260e86889b3afbd1c8bc12923197715db266cc7a01ca57159f7596",
+        "29466f51c011fd10181494a9379b6159b808ae0fcb0161f8f07909ff041b1965",
+        "6591a3c3c767b38d805ed3f7eb6763e8b3d2d642e7307745cd3418eff69a19ed",
+        "1d84b04b1338b0d2e3c98f7aea3e98effc530a5044b93b96c67ee379d62e815f",
+        "6fa295272532e983e166b12e4999c052f89d9f30ae1481f3d60eae85f8ee178a",
+        "4ed8caa98ec39f6a629f9a654a447e7e3e4faeecf34dcf658d2d4b98b7a2ec1a",
+        "cfab8299a0da0c2a7e8ff54d0a676d141ab26bc0012e5f668e85d814bc9888b0",
+        "a626543c271fccc3e4450b48d66bc9cbdeb25e5d077a6213cd90cbbd0fd22076",
+        "05cf3a90049116dc60efc31536aaa3d167762994892876dcb7ef3fbecd7449c0",
+        "ccd61c926cc1e5e9128c021c0c6e92aefc4ffbde394dd6f3b7d87a8ced896014",
+        "3ffa4f6dafa57f1c50f1afa4f81292ae71a06fe4f8ff46c51d32ff2613489f2b",
+        "19d3921cfc0f1a2bb813b3dfa96df90e2c6b87d78e9238f85bbc77ae9a73f98f",
+        "f5c916ff2badde3e29a5f940233ea34007d8f182a48a808b46bb8058003f1903",
+        "6ba07a1af758e682d3e09add2d3dcdf35d9553f6799854a27e536063c57f81a5",
+        "b78378fb446c544b04d4a152ac49573161b3ddebf69386770a55a7d47b880e5d",
+        "b519538fe1626f0c595945ada58a344faac0061761cc9d4a841419bd32eec0d9",
+        "96e488b027896413f4034b0354f48484f6cfc10f8ec57b026fd21a3b88361a74",
+        "770c8a5f47bfd769ced35a71afc3ca1ff4c1f1e7cc3d2356de945004368d8145",
+        "6df9d8d0d3a8d98c8350d7162bd15579d5707add7611a00eeb6ca5743ed78cb7",
+        "4f0fe8fc17901591cf348730e187de523d6d7568c1fbd82485913985eb67971c",
+        "0ef3bb35cf372bd94e3f80eecebd50ef0d0308e01e0ed6de0f5a8a8c818a0074",
+        "c038d3e809a5e3a58db2f91c15ae12439578f75485cd84f556c6971e8e250620",
+        "ce399a0f08277d8d4816095060ebbf33da016fb43a6c356d5a3fe4bb574c5e7b",
+        "869f7e316b194f9531bcaf33f7913f1b9cfc6bb5dcf86b692bf8cab29b8aa96f",
+        "327dfa464459d9e48f5e55c7f5baa68fc4a25ad622bc7bf01aca82fd5e72314c",
+        "e00dad3151b9085eae786984fe20735232b7ff7f1b1db7961fd0d0e0f605db9a",
+        "076f644520d0b4732d6c531c9349089026936d99820461da87749a520fbe90ce",
+        "b4414ca1373be46f15cea6b1255a7d1886c6fdb08ed5af9657d5aac317de3a29",
+        "8d1ab0263dab7b86ecee219162d999a01245572269de31100e5d88fc1b1eaa69",
+        "b48d1c1f83924a02a23e5e0f971e16e87fc4884853833485191a2b60722fe269",
+        "f2edd5f750a20a541d3f6bd5df80838f11825b25a98f3da5e1523bff813bb560",
+        "07166004ef88e1614ebdc887dfc7da42ebcda02d92c12f18d1186ce3c98710e4",
+        "69f83aa101d69b8f1220dc1c538d8934458420be335feb46ffc47a2c8e2e6a8a",
+        "e1469f16c6fca15119a272e585c7f50421bc8a414c864fc76b01048d4c6fc5d2",
+        "6763343a1c80f19283a80af854e7e9065c2a8349ef11f11bfb76ba9f97048539",
+        "1ae3a0b8b2c7885ba318ad6fd449fc4d7f8404b59cf3275fcdea13563425772d",
+        "3a71184cbe8eb58e6812ba7a7a1dca0ca28eec63782f2e6e3c0b87073f533ffd",
+        "184ccf2a52f388c9f897a857fe7ccec2959911a8d1e09ee8804d8d5d508dd918",
+        "a66d409af7afd75be831dd498c196ef12c73c31129ec02d5f12ab02a2c63a25e",
+        "58b37497fcf0be0e0cf1734045c295b286c76a7c048e87c54028ed36915b5df3",
+        "2c7333540a832d64456e43058c50d93c932ad9b18b3fc3a0599207cda3b3c7a6",
+        "3dc062ffb57d835fe3aa409466822f9186918423947505165fdcdfb7306f7259",
+        "89204844acb92f353bfc89a3ce8a9817219c101385c593cf60e0befa9638e14e",
+        "782ba902e91232941c78c49cd9771a5d9992f9b07d9c0a2df82d385d15c42bb3",
+        "0dc3ff7df0dfc023763d7634e18da27393fc9fdb1c154646861075f0a87d0e90",
+        "b95c65fb6f254edbde8c037d5c8b2039340f4ac2b023a6aa28a8fcd2d2689cf4",
+        "87e8f51572a5d6a239f85bc53e1174e15be12fcdf151a0b9a2b43640caf74c1d",
+        "2a6f3e462c405c354fe80fccced1c9be44325d29e07da30960b625a76ea42f83",
+        "20b46c8fbfca97453262460f8498a7e2af15ac79b59ddfb027bb52f2d68e8f51",
+        "31b0763cb9ba92403dca1abdd7342d7de94c581e76f7c9a61e515928e10b4e77",
+        "e191e117063cfac9642cd93cb42b39eddd9e4ab65f1d0397e3e17dd04cab1180",
+        "225a202107a74703e041c6cca4eacf4f21eea6f22a146d8da2ab8cf6197229a5",
+        "efc4836be4ac3e9791d2ec62226e7df64118f4565c19e6c9e84063f5661c7b2f",
+        "3a76b0152c0e1d1fd7ac9d91a28a18e1a4c06080f2b7ecefb6effe28b8cfc765",
+        "0d46ad039070115828f94eb6b72963e60a7d2db7ca8991d225c3877b149b0a8a",
+        "e44cfc42118f096bfc51521cb18d5d6525586b989f4ee2b828c5199feab94b82",
+        "6d4bd2e073ec4966847f5cbe88ddfaba2be4caf2f333552b8553da533487c25b",
+        "bbc46db437d107c967ca6d91455bbdfe052118abd1d069f04359487e13aea0e1",
+        "b974c14db7d3174dd06084bb303108b2f0daf50eccc3293543795c9636c62482",
+        "0eee235b06936aed7173c8c19aa7c217b9eedaeb1a88f30552e9225145149e82",
+        "36d089e025b5686937742825e6ee3d83e7d7a50c823c82883460f385147dc17b",
+        "77ee4ffc9f5dd605470dc0e74d6b17c5130d8b73913f36d5f8787e619a947ca0",
+        "0fe6c2ab754233360d68b9ac80cd61184bfaa7d356294180025fe40639c76c36",
+        "996088c79456ecdda1fbc02ee1ba42d91d858c310a5a8b4674fe6a7c144414a1",
+        "9e338aed0bc71c0c97f19855bf49174f70a9d77014873663213427502bd85d9f",
+        "4a843d26adec520e4b5dbf0145cc4f5024fafcdc2025824a8c64650617687ee7",
+        "c91678c4a64e2fa4b74de61ad0c06ff06b5d672fa7c6877a4014ce9e91be38d7",
+        "ff7777405d327adb58301c711ecdc2bce1bfa829ffc9b117f21a2b198d0d6884",
+        "0a8ddaf1728c5cd93a255d5623c3dada2d3d0571bf1438adc8c964a9aad118cb",
+        "c133abbd0d2d808a67b6745b4b3650b4a64dc276cf98e30357b6abd5c1d22a9b",
+        "c59ee5c196ba3cfef94087798207bdcef139ce2cf78dced6198f0fa3a409131c",
+        "c7fdade59c4699385eba59e756c2b171b023deae082e5a6e3bfbdc1073a32003",
+        "975327c5f4dec6414b6e00cb042337b8d2a6564637a7442aec7be8f8c89a2f1c",
+        "a2f7246df4a24efbacd3fd60683abc868bef25327052cf2f1d93ece4ffcd73c6",
+        "497fb2acacf123f3595e40fc51a7bd24458bbcba4a2940a5cb03d608fbdf2825",
+        "0e97d22793ce6f283d5c740d308a27ad7c3b0d9afcd3d9e9b9cac56b10290c8f",
+        "6630b35618e700d910683893795ef70bf07eb156f55ffe3b69ad88a4b8b0bfa1",
+        "02f742c6e95278121a05e44205444fc5ea6af5e741c535bc2cbc3b235a2ea2b0",
+        "4622f36eb898383f60d5bed809ac5c4745c5d6ab84bcadf79cf2a96d4ec88818",
+        "ccd11faaa0581ec32c3a403f92ef43d5dcf195c1a101dbfd495dbb4dce8069e0",
+        "06024d6b07e000bce613470a2880519b8be4a36bf33c99c917893ec75dd90fe3",
+        "d93af947b1463a817db441a474588d6f996d243983e83c7eee90e1efa440d9ba",
+        "94898945a7db259e1b2e7cbea48aa0c6d6570d18179f0618471c88f3ec3b0fc3",
+        "4c2d935256392aa2be6e1078c0593815abef469de969b57b881b93af558465fa",
+        "aac7be16e52f790e4ff70b24015cb11b40616e94db13882b41d3dd8c8c1952b7",
+        "0434b47c0ee7e6f53906799a43209d3fc37d3fd1f74555de67abacb951b006f4",
+        "0442fbdd5b58496ec78159ccaa887c88a861fcca70e7abc976f24c11588be6ee",
+        "a73e68bb18b007648e76b5528d1e50e7fa654da3970ec349bf591a30d932c8f6",
+        "849cf873162ba72c4b8008e68f932fb3a015a74fcf957198d56a0dc4625a74f5",
+        "a6dec6fc8949349c4e9a9c623687fba4c9b275bdb230509b72e3d6711914e2d8",
+        "58afc2b24a19fdbf76a09b70b1e3b77fcbd4065001d9636640eb5a2628f442cc",
+        "473a43aa1d6a028767432a830ad1221e029c589af9fd4d68d56c4fb820259352",
+        "a0aeb4a5ad899af2e291b2e79dbb6b0bf56b5844676b955d945b6c4ae1c01eed",
+        "cfc3029a9eeb152222d96653492e46ca64ca4f0d64683028d3aee5a49cb47163",
+        "7467cf7761cd9f55618d30c9d8c5b41e4701510c7d16ab4e5d89a5d77146b092",
+        "c016d8424e531efc5737c03fc90a5efc9f9022e4d5ba3b0695f7ae538260c2ee",
+        "5d381189e6000fc117c71f59f786fb4b79fdd4ec5d4cd30aac2157f75dead778",
+        "7c9cdd15c4c9abcacbfe6f664a7f5f8b2e259183291ae5cc9130a0b241e5737f",
+        "b8813172f5218ac3eb687bc4afaff83fbca4e9c1a462963301dd4459850150a2",
+        "e3d130e36a028ea80c57a2aa4819fd34e4dbbeb14a495894b15a8787db1a9f9c",
+        "fff1b4400f489e07d22351c1f09565e265b68ad29f6329879e6b5f7f6b419350",
+        "559ed5bb3e5f3985fb578228bf8c0f0b173f8d1153faeb9fec756ffd18a87238",
+        "88131253014d23c5e38e78bda19455d8a023bd7a7e727457a152a81d0b1718a7",
+        "f4d3fae7cde6bb66715a198fa48d210c10f8df3204ae5e33a602467f1b622685",
+        "e62b622ac8a21366bf2ded30f4082a53e77a9aa696b1f3ee8cfe99c59312d9c7",
+        "3d39ffa85512c3c8890d4bdf31889ca66e5cecb63cfeed57b9263708e74c550b",
+        "b1703b8a00e2612497d11c649d150a6c963bf4fd38feb1c381fe0d9b04c02b22",
+        "12fbad9d3782812d71179a50fbd9b4566c7b06f5d77c6f329717fb4ae2c5b4ec",
+        "768b659a824b43f9ca5660b9ddf05f8ba2bc4993866b7c9be68791f5b24644b3",
+        "c0204e23ca86be205eed0cc3dd7225ce5ffe1ee12dacb93c5d0629b7699cd733",
+        "f43296961f8eaeccd854413dc5adda62393a344627e86c066e7907550040744f",
+        "82f4469e80789021c61db7e32f36acbe591a64f26059265770ae658d62bde7ef",
+        "2a85671a55c89fa156e296f75df1c7dbab178ebba65204a7e8178c916ad087f8",
+        "33e245002808f6934b9be3a6fa8e8670c90baa625717b9201eb9b9dd912f5ce2",
+        "58ee5e799184ad9da9a17c5b46a4810e28bdd08c3581634c835030539b79544d",
+        "26d8fa08db308edf2f96f82af6b60c17d8f1ff858c52f2d0f3831078127526a3",
+        "25a58df4039247a22f68ff2b71766b7b5600ddf401d99ff2c1955ae7bb43e56a",
+        "be43e8686160e907ba547d5a879d10f788afc842b8ebb9f3f788532515912ae4",
+        "aa4acb95d879192a6908e88ae3d6589f4e3eb3d4e03a806ccdb9b5d6a9586fdf",
+        "8466d5e44ce95b4fa179992444b8c2485b886448a6dccfcf0bc30bc5f0f56b01",
+        "0056d7e0ac33355783659b38ec8beccbf783939967fe37aeacf369ddb670ada0",
+        "904f42f345530ac8a352d09b6872c5bca3661abca6ca64c8099f2fb6867c30fe",
+        "a8c3bf46f0b88bbd16fda4a8b5ca81f5243520c385d38c0b4d2352ab34ea35e6",
+        "8d3317fc606e566d302edab55e801611d8c13f4a9a19d185978def72839cdaa3",
+        "97388011f57a498690ec7988eff903ff9b2358f5b61baa20f73290d6296c1c0b",
+        "cfb80cab8990950809123fbf85e976454708e0afed698e3352a31635909db3e5",
+        "0daaca55132a235b831a5eff4ea467cd10af44200847735a1ffd51fa37eaa2a2",
+        "69b21497ebb824ba665368188825e6f6f14cf2c3f7b5530bb34fa658eed9a739",
+        "b9a19f509be03fbc40e243a58a3ded11f0d51f80e3e29a505644cc05743814ec",
+        "c4bcb2002555d544fd0b02770623891e70eeec7744865dd6455ad665cc82e861",
+        "912d24dc3d6923a483c263eba81b7a8797f23cbf2f78b51e2226639f84a59047",
+        "56827a18883afdf9ceec562b2066d8acb2c19505ece6f7a83e9f3346cbb828c9",
+        "251d8d09fc48dd1d6af8ffdf395091a46e05b8b7c5ec0c79b68a8904c827bdea",
+        "c2d14d69fd0bbd1c0fe8c845d5fd6a8f740151b1d8eb4d26364bb02dae0c13bc",
+        "2e5fe21f8f1b6397a38a603d60b6f53c3b5db20aa56c6d44bebd4828ce28f90f",
+        "25059f10605e67adfe681350666e15ae976a5a571c13cf5bc8053f430e120a52",
+    ]
+
+
+class BLAKE2spKeyedTest(HashTest):
+    hash = blake2sp(key = bytearray(range(32)))
+    vectors = [
+        "715cb13895aeb678f6124160bff21465b30f4f6874193fc851b4621043f09cc6",
+        "40578ffa52bf51ae1866f4284d3a157fc1bcd36ac13cbdcb0377e4d0cd0b6603",
+        "67e3097545bad7e852d74d4eb548eca7c219c202a7d088db0efeac0eac304249",
+        "8dbcc0589a3d17296a7a58e2f1eff0e2aa4210b58d1f88b86d7ba5f29dd3b583",
+        "a9a9652c8c677594c87212d89d5a75fb31ef4f47c6582cde5f1ef66bd494533a",
+        "05a7180e595054739948c5e338c95fe0b7fc61ac58a73574745633bbc1f77031",
+        "814de83153b8d75dfade29fd39ac72dd09ca0f9bc8b7ab6a06baee7dd0f9f083",
+        "dfd419449129ff604f0a148b4c7d68f1174f7d0f8c8d2ce77f448fd3419c6fb0",
+        "b9ed22e7dd8dd14ee8c95b20e7632e8553a268d9ff8633ed3c21d1b8c9a70be1",
+        "95f031671a4e3c54441cee9dbef4b7aca44618a3a333ad7406d197ac5ba0791a",
+        "e2925b9d5ca0ff6288c5ea1af2d22b0a6b79e2dae08bfd36c3be10bb8d71d839",
+        "16249c744e4951451d4c894fb59a3ecb3fbfb7a45f96f85d1580ac0b842d96da",
+        "432bc91c52aceb9daed8832881648650c1b81d117abd68e08451508a63be0081",
+        "cde8202bcfa3f3e95d79bacc165d52700ef71d874a3c637e634f644473720d6b",
+        "1621621f5c3ee446899d3c8aae4917b1e6db4a0ed042315fb2c174825e0a1819",
+        "336e8ebc71e2095c27f864a3121efd0faa7a41285725a592f61beded9dde86ed",
+        "079be0410e789b36ee7f55c19faac691656eb0521f42949b84ee29fe2a0e7f36",
+        "17270c4f3488082d9ff9937eab3ca99c97c5b4596147372dd4e98acf13db2810",
+        "183c38754d0341ce07c17a6cb6c2fd8bbcc1404fdd014199c78be1a97559a928",
+        "6e52d728a405a6e1f87587bbc2ac91c5c09b2d828ac81e5c4a81d03dd4aa8d5c",
+        "f4e08e059b74144bf948146d14a2c81e46dc15ff26eb52344cdd474abea14bc0",
+        "0f2e0a100ed8a11785962ad4596af955e30b9aef930a248da9322b702d4b6872",
+        "5190fcc732f404aad4364ac7960cfd5b4e348629c372eeb325b5c6c7cbce59ab",
+        "c0c4cb86ea25ea957eec5b22d2550a1649e6dffa316bb8f4c91b8ff7a24b2531",
+        "2c9eda135a30aecaf3acb3d23a3035fbabba98333165d87fcbf8fe10336ecf20",
+        "3cd669e8d56262a2371367224dae6d759ee152c31533b263fa2e64920877b2a7",
+        "18a9a0c2d0ea6c3bb332830f8918b0684f5d3994df4867462dd06ef0862424cc",
+        "7390ea4104a9f4eea90f81e26a129dcf9f4af38352d9cb6a812cc8056909050e",
+        "e49e0114c629b494b11ea98ecd4032731f153b4650acacd7e0f6e7de3df01977",
+        "27c5702be104b3a94fc43423aeee83ac3ca73b7f87839a6b2e29607903b7f287",
+        "81d2e12eb2f42760c6e3baa78f84073ae6f5616070fe25bede7c7c8248ab1fba",
+        "fab235d59348ab8ce49bec77c0f19328fd045dfd608a530336df4f94e172a5c8",
+        "8aaa8d805c58881ff379fbd42c6bf6f14c6c73df8071b3b228981109ccc015f9",
+        "91fdd262203916394740952bce72b64babb6f721344dee8250bf0e46f1ba188f",
+        "f7e57b8f85f47d5903ad4ccb8af62a3e858aab2b8cc226494f7b00bedbf5b0d0",
+        "f76f21addae96a9646fc06f9bf52ae0848f18c3526b129e15b2c355e2e79e5da",
+        "8aeb1c795f3490015ef4cd61a2807b230efdc8460173dad026a4a0fcc2fbf22a",
+        "c564ffc623077765bb9787585654ce745dbd108cef248ab00ad1a2647d990387",
+        "fe8942a3e5f5e8cd705104f88210726e53dd7eb3f9a202bf9314b3b9065eb712",
+        "dc295359d436eea78084e7b077fe09b19c5bf3d2a796dab019e4200599fd8202",
+        "70b3f72f749032e25e383b964378ea1c543e9c15de3a27d86d2a9d2231eff48a",
+        "7982b54c08db2bfb6f45f35bc323bc093779b6bb0e3eea3e8c98b1de99d3c55e",
+        "75e4162257014bedcc05c2944dce0df0c35eba131954064f6e4e095fd08445ee",
+        "4a129ea6cdbabc2d392479372f975b9cf5a1b7deb69a3266f03ebc6d111393c4",
+        "8fed70f27955dc8ad9f1b7b3f6f5dfbd962a33592b42de856d421e2912bab86b",
+        "e2f20660376f2b1839667cbfe5e16ef075ac3943644f3532282f8bb0723b9986",
+        "abf84c913a83df98c70029819c065f6d6de4f6d43abf600dade035b23bed7baa",
+        "459c15d4856c7ecf82620351c3c1c76c403f3e9707741387e299073fb1704b2b",
+        "9ab912eda0768abdf826b6e05d0d735839e6a5f02e04c4cc75650b2c8cab6749",
+        "4740ebecac90031bb7e68e51c55391afb189b317f2de558766f78f5cb71f81b6",
+        "3cc47f0ef64821587c937cddba85c993d3ce2dd0ced40d3be33cb7dc7edabcf1",
+        "9f476a22db54d6bb9befdb260c66578ae1d8a5f87d3d8c017fdb7475080fa8e1",
+        "8b68c6fb0706a795f3a839d6fe25fd4aa7f92e664f762d615381bc859afa292c",
+        "f640d225a6bcd2fc8accafbed5a84b5bbb5d8ae5db06a10b6d9d93160b392ee0",
+        "704860a7f5ba68db27031c15f225500d692ab247534281c4f684f6c6c8cd88c7",
+        "c1a75bdda12b8b2ab1b924843858183a09d202421fdbcdf0e63eae46f37d91ed",
+        "9a8cab7a5f2e576221a6a85e5fddee75678e065324a61db03a39261ddf75e3f4",
+        "05c2b26b03ce6ca5871be0de84ee2786a79bcd9f30033e819b4a87cca27afc6a",
+        "b0b0993c6d0c6ed5c3590480f865f467f4331a58dd8e47bd98ebbcdb8eb4f94d",
+        "e57c103cf7b6bbeb8a0dc8f048625c3f4ce4f1a5ad4d079c1187bfe9ee3b8a5f",
+        "f10023e15f3b72b738ad61ae65ab9a07e7774e2d7ab02dba4e0caf5602c80178",
+        "9a8fb3b538c1d6c45051fa9ed9b07d3e89b4430330014a1efa2823c0823cf237",
+        "3075c5bc7c3ad7e3920101bc6899c58ea70167a7772ca28e38e2c1b0d325e5a0",
+        "e85594700e3922a1e8e41eb8b064e7ac6d949d13b5a34523e5a6beac03c8ab29",
+        "1d3701a5661bd31ab20562bd07b74dd19ac8f3524b73ce7bc996b788afd2f317",
+        "874e1938033d7d383597a2a65f58b554e41106f6d1d50e9ba0eb685f6b6da071",
+        "93f2f3d69b2d36529556eccaf9f99adbe895e1572231e649b50584b5d7d08af8",
+        "06e06d610f2eebba3676823e7744d751aff73076ed65f3cff5e72fd227999c77",
+        "8df757b3a1e0f480fa76c7f358ed0398be3f2a8f7b90ea8c807599deda1d0534",
+        "eec9c5c63cc5169d967bb1624e9ee5ced92897736efbd157548d82e87cc72f25",
+        "cc2b5832ad272cc55c10d4f8c7f8bb38e6e4eb922f9386830f90b1e3da3937d5",
+        "368985d5387c0bfc928ac254fa6d16673e70947566961b5fb3325a588ab3173a",
+        "f1e442afb872151f8134956c548ae3240d07e6e338d4a7a6af8da4119ab0e2b0",
+        "b012c7546a39c40cadece4e04e7f33c593ad182ebc5a46d2dbf4ad1a92f59e7b",
+        "6c6097cd2033096b4df317de8a908b7d0c7294390c5a399c301bf2a2652e8262",
+        "ba83feb510b49ade4faefbe942781eafd41ad5d436888531b68859f22c2d164a",
+        "5a069e4392195ac9d284a47f3bd854af8fd0d7fdc3483d2c5f3424ccfda15c8e",
+        "7e88d64bbbe2024f4454ba1398b3d8652dcec820b14c3b0abfbf0f4f3306bb5e",
+        "f8742ff46dfdf3ec8264f9945b20419462f069e833c594ec80ffac5e7e5134f9",
+        "d3e0b738d2e92f3c47c794666609c0f5504f67ec4e760eeeccf8644e68333411",
+        "0c90ce10edf0ce1d47eeb50b5b7aff8ee8a43b64a889c1c6c6b8e31a3cfc45ee",
+        "83917ac1cdade8f0e3bf426feac1388b3fcbe3e1bf98798c8158bf758e8d5d4e",
+        "dc8eb0c013fa9d064ee37623369fb394af974b1aac82405b88976cd8fca12530",
+        "9af4fc92ea8d6b5fe7990e3a02701ec22b2dfd7100b90d0551869417955e44c8",
+        "c722cec131baa163f47e4b339e1fb9b4aca248c4759345eadbd6c6a7ddb50477",
+        "1837b120d4e4046c6de8ccaf09f1caf302ad56234e6b422ce90a61bf06aee43d",
+        "87ac9d0f8a0b11bfedd6991a6daf34c8aa5d7e8ae1b9df4af738005fe78ce93c",
+        "e21fb668ebb8bf2d82086dedcb3a5371c2c46fa1ac11d2e2c566d14ad3c3653f",
+        "5a9a69815e4d3eb772ed908fe658ce5087310ec1d50cb94f5628339a61dcd9ee",
+        "aac285f1208f70a64797d0a9400da64653301838fef6690b87cda9159ee07ef4",
+        "05643c1c6f265925a65093f9de8a191c4f6fd1418fbf66be8059a91ba8dcda61",
+        "1c6cde5b78103c9e6f046dfe30f5121cf9d4039efe222540a41bbc06e469feb6",
+        "b49bb46d1b193b045e7412059fe72d552552a8fb6c36410723dc7d05fcceded3",
+        "b612d3d21fc4de3c791af735e59fb717d839723b42508e9ebf7806d93e9c837f",
+        "7c3390a3e5cb27d1868ba455cfeb3222fde27bcda4bf248e3d29cf1f34329f25",
+        "bd42eea7b35486cdd0907cb4712ede2f4deeccbca191603865a1cc809f12b446",
+        "d1dd6201740cfaad53ceccb756b110f3d50f817b43d7559557e57aad143a85d9",
+        "5829643c1b10e1c8ccf20c9b4af821ea052d7f0f7c22f7380bbbcfafb977e21f",
+        "fc4cf2a7fbe0b1e8aefbe4b4b79ed84ec97b034f51b4e97f760b20639765b933",
+        "4d7c3b3438a0bda28e7a96e42027d813e88ae62885499833d3c5f6359ef7edbc",
+        "34cbd32068ef7e82099e580bf9e26423e981e31b1bbce61aeab14c32a273e4cb",
+        "a05dda7d0da9e094ae22533f79e7dccd26b1757cefb95bcf62c4ff9c2692e1c0",
+        "224ccffa7cca4ce34afd47f62ade53c5e8489b04ac9c41f7fad0c8edeb89e941",
+        "6bc6076483aa11c07fba55c0f9a1b5da87ecbffea75598cc318a514cec7b3b6a",
+        "9a0360e23a22f4f76c0e9528dafd129bb4675fb88d44eaf85777300cec9bcc79",
+        "790199b4ca90dedccfe32474e85b174f069e3542be3104c1125c2fdbd69d32c7",
+        "55839925834ca3e825e99241874d16d6c2623629c4c2adddf0dba01e6ce8a0dc",
+        "615ff846d993007d38de1aecb3178289ded09e6bb5cbd60f69c6aa36383020f7",
+        "f0e40b4ed40d34851e72b4ee4d00ea6a40ea1c1bf9e5c269710c9d51cbb8a3c9",
+        "0b07b2333b08d08c11ca34ab449b71d29a0f43e1f778e073e79006ccb730ed62",
+        "d1f4c29d9f23ea35ec4035b377d506538e728bc739c1459680cf1cc69424924d",
+        "1279cf6f669f92f6bfc25d605b9440c7dccbd25df28dc7353abc1c0530405dc4",
+        "1fa0af00775dc2ce76506d3280f472d2f6ff97a2151faa827942fea44ad0ba1f",
+        "3e1ad54a5f835b983bd2aab0ed2a4c0bdd7216209c36a79e9e2aabb99faf3512",
+        "c6ed39e2d8b636eccba245ef4e8864f4cd946be216b9be48303e08b92dd09434",
+        "e24736c13ecb9f36a0d829d4798d7699c14cc65b6dc44ed6f10cd4853d6e0757",
+        "389be88052a381272c6df741a88ad349b712718435480a8190b704771d2de637",
+        "889f2d578a5daefd341c210984e126d1d96da2dee3c81f7a6080bf84569b3114",
+        "e936095b9b982ffc856d2f5276a4e529ec7395da316d628702fb281ada6f3899",
+        "ef89ce1d6f8b48ea5cd6aeab6a83d0cc98c9a3a207a1085732f047d94038c288",
+        "f925016d79f2aca8c49edfcd6621d5be3c8cec61bd5871d8c1d3a565f35e0c9f",
+        "63e8634b757a38f92b92fd23893ba299853a8613679fdf7e0511095c0f047bca",
+        "cf2cca0772b705eb57d28943f83d353fe291e5b377780b374c8ba4665830be87",
+        "46df5b87c80e7e4074aee68559424742845b9b350f51ba55b074bbae4c626aab",
+        "658aa4f9d2bcbd4f7f8eb63e68f5367edbc500a0b1fbb41e9df141bcba8fcd53",
+        "ee80555008a71655e081092bba6f670ed98af9a09fb5afb94cbc5c754814db4f",
+        "2c5f9d048220b041b6d4524b4490cf8c66fcb8e14b0d64887aa1e4761a602b39",
+        "44cb6311d0750b7e33f7333aa78aaca9c34ad5f79c1b1591ec33951e69c4c461",
+        "0c6ce32a3ea05612c5f8090f6a7e87f5ab30e41b707dcbe54155620ad770a340",
+        "c65938dd3a053c729cf5b7c89f390bfebb5112766bb00aa5fa3164dfdf3b5647",
+        "7de7f0d59a9039aff3aaf32c3ee52e7917535729062168d2490b6b6ce244b380",
+        "895898f53a8f39e42410da77b6c4815b0bb2395e3922f5bed0e1fbf2a4c6dfeb",
+        "c905a84984348a64db1f542083748ad90a4bad9833cb6da387293431f19e7c9c",
+        "ed37d1a4d06c90d1957848667e9548febb5d423eab4f56785cc4b5416b780008",
+        "0bc65d9997fb734a561fb1e9f8c0958a02c7a4dbd096ebef1a1751aed959eed7",
+        "7c5f432eb8b7352a9494dea4d53c21387031ce70e85d9408fc6f8cd98a6aaa1e",
+        "b8bf8e2c34e033983639909eaa37640d877b048fe299b470af2d0ba82a5f14c0",
+        "88a9dd13d5dadbdee6bff7ee1ef8c71cc193aa4bf3e84f8fe80cb075683c0779",
+        "9aedb8876dd21c8c84d2e702a13625980462f68bf0a1b7254ad806c38403c9de",
+        "d097573df2d6b2489a479484869800a1f833ea169eff32ae3ce63a2079548d78",
+        "d18f27a3e555d7f91a007c67aceede391f75a61fa42a0b4566eb582ca05ebce7",
+        "df1daa90b1702313e6a5901c7afc5ed9657717a715fa53a4189ec1e5df293a68",
+        "04e3a496b66996c66e32919ed1f94c36eebbf240633a2f739845f0295d34afba",
+        "8c45d88c4e9c9d0c8c677fe48fa5449ba30178d40af0f0217921c62e4b60cdd3",
+        "e149a6b13bdedea2eeee009ce9445e8dcf76b76e55a501d8f5b43ff896796ad1",
+        "a837c4c7c6f5cfb99e1085fd43287a4105cb28b76fc38b6055c5dcff78b82565",
+        "42411f28780b4f1638540b870521ec45bceb1e0c7131f7e1c4672e436c88c8e9",
+        "34b4e876769471df552e5522cea784fa53ac61bede8cfe291409e68b69e8776f",
+        "8f31d637a91dbd0ecb0ba0e694bec1447658ce6c27ea9b95ff36701caf36f001",
+        "b5c895eb071e3d38528d475d3bb0ba88b71795e40a982e2ac2d84422a0f2685d",
+        "e906257c419d941ed2b8a9c12781db9759a3fcf3dc7cdb031599e1086b672f10",
+        "98ad24397c6eae4cf73ea8bbef5a0b74d21ad15f33920f44070a98bdf53d0b3a",
+        "dd510ca55b1170f9cefdbb16fc145262aa363a870a01e1bc4fbe40234b4b6f2f",
+        "f2d8d931b92e1cb698e56ed02819ea11d26619b83a6209ad67225368fe119571",
+        "e4637055db91f9437cf460ef40b5145f6998266a5e74e96a00782c62cf30cf1c",
+        "3563530a89d32b75f78d83e9872ad4c575f520399d65035ded99e5eec5807150",
+        "8e79f92c865beb3e1cdbf08f754a2606e85349053d66d616024a813fca541a4d",
+        "864226f2839c76b1d5f7c13d98c2a5158c2abb71d9d8f0fa1f7c3f7468001603",
+        "d3e3f5b8ceebb11184803535900b6eedda606eeb369751a7cda36ca30229fb02",
+        "8c7d6b987269169031f71fd7e4c445012d3e6a3c8809f6479bd667cf311e276e",
+        "b904b5711bf19e8532f7ad6427410a62a1f77f77b9b6d71d2fc43bc90f73235a",
+        "4536634315c86728f5ab7449eb2d04020e9eae8dd6795500e9ec9a0066386e69",
+        "fd5e49fed49dc44bde89f460a950191ebb067c698a3f21ea14308c7413b91681",
+        "31f01d030b9b22d00a0f71ed2ceb5d2dc81af2c24bf5670fde19a685e8d1392e",
+        "5f84d9de284b1e4f678e31ab6a76f5661b5aeaa768539384aa38f9e49cce6e6e",
+        "b2079e5997a4ead3a71fefc02f90a7483a10fd2e6f31bda9d2084485cc016bbd",
+        "e0f84d7f525b6fed791f77289ae58f7d50a29432d42c25c1e83929b838891d79",
+        "70469690956d7918ace7ba5f41302da138c9b56ecd415544face8d998c21abeb",
+        "45c91a62249b39cda94e508295bec7667119447765ef80efa82d1e92d57067d8",
+        "1d9e0073eed0731554c3beaa47460d511ad261dd4d4a3bed9d8d202f22f21589",
+        "408262736d8aec0b847dba250258608a4345a63a1eb195e5c7ae2ee874c34da8",
+        "23d2b70439469949982390538d7e5ade9f18c8e3bbf6605afcf49b00c061e837",
+        "232fb187d271bea912efd407ffe08056d6a42e5321ec792df3d584a94f630ab2",
+        "138e1944e4b54de8681d7e48c4f08148e40a567e5cad946a6af4e8d5d26f75c7",
+        "80c151325fbfc678b7be4e40b30f29fe31cdbe1c84126e006df3c18524bd2d6c",
+        "a642267301669df261b839f87365762905ff320a0a2fc4bdc48e5a8e15d13233",
+        "0f8b10993860937a74cc2de40a2731dd9954b654bb94c34e876652e98d4bbd16",
+        "e634a58512493273260f10d44953cd998e34cb8281c41bf42e0ae2f25cbd1f75",
+        "bde6af9baf3c07e95423cab504dee70edcc3318b22dd1eb6fd85be447ac9f209",
+        "914b37ab5b8cfde6a480466a0d82432c7d76328e9a88ef5b4f52429f7a3ffc7d",
+        "55be66e9a5aa671a23882ef3e7d9d36ea95487dc71b725a5ad4b798a879143d0",
+        "3fd045894b836e44e9ca75fbe3eadc486cbbd0d8cee1b3cf14f76e7f1e77aef3",
+        "ce60343dc4874b6604e1fb231e37ec1eec3f06566e428ae764efffa230add485",
+        "e38c9df024de2153d226738a0e5ba9b8c6784daca65c22a7628eb58ea0d495a7",
+        "8dfec0d4f3658a20a0bad66f2160832b164e700a21ec5a0165c36772b2086111",
+        "4401b50e09865f4238243b8225ca40a08dbb4685f5f862fbdd72980431a85d3f",
+        "8668942788c4ce8a33190ffcfad1c678c4fa41e99417094e240f4a43f387a3b6",
+        "a7288d5e09809b696984ecd5326cdd84fbe35fcf67235d811c82002536a3c5e1",
+        "8e925c3c146bacf3351ec53241ace5f73e8fc9bd8c61cad97fd772b07e1b8373",
+        "c7eb9e6ded2f993d48b0170da27c5b753b12176be126c7ba2d6af85f8593b752",
+        "ca27f16f94e4ec0e628e7f8aefc6657bedc93742965940ae786a73b5fd593b97",
+        "8c21e6568bc6dc00e3d6ebc09ea9c2ce006cd311d3b3e9cc9d8ddbfb3c5a7776",
+        "525666968b3b7d007bb926b6efdc7e212a31154c9ae18d43ee0eb7e6b1a938d3",
+        "e09a4fa5c28bdcd7c839840e0a383e4f7a102d0b1bc849c949627c4100c17dd3",
+        "c19f3e295db2fc0e7481c4f16af01155ddb0d7d1383d4a1ff1699db71177340c",
+        "769e678c0a0909a2021c4dc26b1a3c9bc557adb21a50834cdc5c9293f75365f8",
+        "b64874adab6bcb85b94bd9a6c565d0d2bc35445d7528bc85b41fdc79dc76e34f",
+        "faf250de15820f7fc610dd53eeae44601c3effa3accd088eb66905bb2653be8c",
+        "1e2038739b2c018b0e9e0e1e522fd9651287ee6e3665919b24c2124f0c1a3f3a",
+        "5fec3aa00861de1ac5dab3c137065d1e01bb03f69dcc7d1cf7ca4f4356aec9a3",
+        "4451fe6bbef39343919244c51dae1ea9a954cf2c0966ab045b15521ecf350081",
+        "8c622fa2160e8e991813f180bfec0b431c6dbfa2956d9175816a23c382c4f200",
+        "817d5c8f92e7b5ca57f5e1639016ad5760e446d6e9caa7498414ace82280b5cd",
+        "a6a1ad58cee54e69cbbcaa87df07a6707eb224739c217613460ab454b459ca9c",
+        "63b847275226605be67681258f7d00bbb307c66f1959bf2e467a41aee714e55c",
+        "fe52ebe5cfcfe6a2297b539fa3dadbd6ebd201aa2ca13563e3d7f14d15abff63",
+        "b7bef9fa5a3d10426246b5f658c08fdf8066eaa3e55a2f7da1591e05c87df8c7",
+        "ded1d6caa9f8f3bda92cea7f6549b1fb86a2211478c4ec289b837efc2b5c27d7",
+        "9f30008a2eb050f18e56a76be92091b2fdc164d56e32c87dd64c9e3a611041b1",
+        "010b6a3b11860088f0abc80a8972cbbc329d5275342950eb9a045afdc8bbed24",
+        "0cd210aac11f1c1ced497f673e53db68c3ec3607f0c5787ddc60a355dfe56c25",
+        "0e56fd01da3b4f8be2c990552aac8d1e8da209bcf4aad4ffb5427fd63172463e",
+        "d6d5cdb11440e34aca3a2fcf30f59e08b11a2a3de539e3e6513ed78a4fee513b",
+        "aa35ac90680670c732ed1ef37e8cbaae49a4d88ecf4df2b689a0f101b756ae47",
+        "278e561288722630e26a5fc954bf2dcd6a65816739abee7be14307a96174e5b0",
+        "ab4b2ca1a2b349981524b6155462f0ff1060bf9bfa07fb9ec69ca471645b6a18",
+        "18a9bbec3c8e1f8ee9571297a93436de427cd270ec69dfe888db7dbf10b64993",
+        "bafc7e43d265a173021a9d9e583d60ed42a803facd6b8360de1f916835389bf0",
+        "a5b67be950fbc2f0dd323a79a19e3ed1f4ae4ba7894f930ea5ef734de7db83ae",
+        "bf1e65f3cd8498884d9d5c19ebf7b916067637604e26dbe2b7288ecb11426068",
+        "c3342cf9cbbf29d406d7895dd4d9548d4ac78b4d00e9b63e203e5e19e9974620",
+        "1c0be60277434b0e004b7b388a37559f84b30c6cf8600f528bfcd33caf52cb1e",
+        "73954530d03f10bef52ad5bc7fb4c076f83f6331c8bd1eeec3887f4aa2069240",
+        "69c11ee04944dea985ac9f13960e73980e1bb0e309f4384a1676f8efab384288",
+        "36fb8fde0ec28ce853fb7175c1b79da3b5e8c39186e78aaece5464dbd9fe2aa2",
+        "6bb2a09dfcaf96962de00c8a082d6df9322b4966ae8d2ecf732411a76a1a0ee6",
+        "7412e7dd1bf1aa9397411bba4d3e0276d2e7a1a29a2477157ad60360d33d4e76",
+        "dddeafcfc72321c849fb25947ab42c1af2a5e43fef681be42c7eaf3660080ad3",
+        "9defebadbdcb0a0e7ff992f947ced3d0a4c899e64fe77360e81e1f0e97f8c1a2",
+        "844c59fbe6476fd189239954f17e36e1f69e24aaed5d5c8b8405ef2a830cc2a0",
+        "ff3fafb67786e01a0c38eadf99c4cae8029da8cf29875fc419bf680009b3bdb3",
+        "ca6760f345678f30a28d628294272a19e3072ebc61b19ff13b318973e97c2738",
+        "c08e1a9047c505264a16447c9ed981a719d381f28e605fd7caa9e8bdbb42996a",
+        "f173ba9d4584cd126050c69fc219a9190a0bf0aececbe611beed193da6ca4de7",
+        "b184876520ded8bd7de25eaefbd3e03688c3be39c19fb73e1f0eccac7cc0f014",
+        "9025db0758bdfb48f0667ebd7e120246598fed01c258764fa0fae334a2a00a97",
+        "e83d8086fabc460d5efc459f95a268f5dc4ac284093c247ca6ec841ad6183fe1",
+        "cc9df41d35aa75928c185f7393666110b80f0986a221c370f45c2eb9016c9a3b",
+        "92f9a594954590fa819817e5d1c28aab2b1cc504d86dba443676bdf866796811",
+        "729562a1e07b0e2605494809bd480f1537cea10dcad43ef9f68c66e825dc46b1",
+        "26f160ab96f5582045146eaff2e2a8d4dab298b4c57e117cdfc5d025c92a2268",
+        "87ebe721383873d247f86182e3f599a7634fcaec5e07b1e83ebb79625ba354e6",
+        "e08d389f75694adc996c22f55d4f859ffd0c1319ff9cedf78c31be84b6f21abc",
+        "1363e22913c6e18e7aa65b83e751c8a2c61b0f307155865a57dba569a99c7b0e",
+        "8878088eb2d1f6d0bb481b4bb187da04bcd8c2c639f005b08054cc41753905fb",
+        "0418d60d05b4e124646ee50e7749a1d209457bc543e3cc1130274aea0f7bf3c1",
+        "7a397e503f293bc42d5f7ef5ec37872460a4f5b5ccde77fb4d47ac0681e5a049",
+        "5c0d2983e72a6dd4e652d723c1dfc12b414c873d4ab4a0a150408eb34347e995",
+        "5623365453c04989c7cf33635e0fc4cddd686fc95a33dfedcf3335794c7dc344",
+        "11f6dad188028fdf1378a256e4570e9063107b8f79dc663fa5556f56fd44a0f0",
+        "0ed8161797ecee881e7d0e3f4c5fb839c84eb7a9242657cc48306807b32befde",
+        "736667c9364ce12db8f6b143c6c178cdef1e1445bc5a2f2634f08e9932273caa",
+        "e15f368b4406c1f65557c8355cbe694b633e26f155f52b7da94cfb23fd4a5d96",
+        "437ab2d74f50ca86cc3de9be70e4554825e33d824b3a492362e2e9d611bc579d",
+        "2b9158c722898e526d2cdd3fc088e9ffa79a9b73b7d2d24bc478e21cdb3b6763",
+        "0c8a36597d7461c63a94732821c941856c668376606c86a52de0ee4104c615db",
+    ]
+
+
+class BLAKE2ManyTest(unittest.TestCase):
+
+    def check_many(self, many, hash, data, **kw):
+        self.assertEqual(many(data, **kw), [hash(d, **kw).digest() for d in data])
+
+    def test_many(self):
+        # Equal lengths go through multi-buffer code, mixed ones partially.
+        equal = [bytearray([i]) * 4096 for i in range(21)]
+        mixed = [bytearray(range(i % 256)) * (i // 7 + 1) for i in range(300)]
+        for many, hash in ((blake2b_many, blake2b), (blake2s_many, blake2s)):
+            for data in (equal, mixed, [], [b''], [b'abc'] * 9):
+                self.check_many(many, hash, data)
+                self.check_many(many, hash, data, key=b'k' * 32,
+                                digest_size=20, salt=b's', person=b'p')
+                self.check_many(many, hash, data, fanout=2, depth=2,
+                                node_offset=3, inner_size=16, last_node=True)
+
+    def test_iterable(self):
+        gen = (bytes(bytearray([i]) * 200) for i in range(10))
+        data = [bytes(bytearray([i]) * 200) for i in range(10)]
+        self.assertEqual(blake2b_many(gen), blake2b_many(data))
+        self.assertEqual(blake2s_many(tuple(data)), blake2s_many(data))
+
+    def test_errors(self):
+        for many in (blake2b_many, blake2s_many):
+            self.assertRaises(TypeError, many)
+            self.assertRaises(TypeError, many, 1)
+            self.assertRaises(TypeError, many, [b'a', 1])
+            self.assertRaises(TypeError, many, [u'a'])
+            self.assertRaises(TypeError, many, [b'a'], data=b'a')
+            self.assertRaises(ValueError, many, [b'a'], digest_size=0)
+            self.assertRaises(ValueError, many, [b'a'], key=b'x' * 65)
+
+
+class BLAKE2ChunksTest(unittest.TestCase):
+
+    def expected(self, hash, data, chunk_size, **kw):
+        return b''.join(hash(data[i:i + chunk_size], **kw).digest()
+                        for i in range(0, len(data), chunk_size))
+
+    def test_chunks(self):
+        data = bytes(bytearray(range(256))) * 100
+        for chunks, hash in ((blake2b_chunks, blake2b),
+                             (blake2s_chunks, blake2s)):
+            for size in (1, 63, 64, 128, 1000, 4096, len(data), len(data) + 1):
+                self.assertEqual(chunks(data, size),
+                                 self.expected(hash, data, size))
+            kw = dict(digest_size=16, key=b'key', salt=b's', person=b'p',
+                      node_depth=1, last_node=True)
+            self.assertEqual(chunks(memoryview(data), 512, **kw),
+                             self.expected(hash, data, 512, **kw))
+            self.assertEqual(chunks(b'', 16), b'')
+
+    def test_out(self):
+        data = bytearray(range(200)) * 50
+        expected = blake2b_chunks(data, 1024, digest_size=20)
+        out = bytearray(len(expected) + 3)
+        self.assertTrue(blake2b_chunks(data, 1024, out, digest_size=20) is out)
+        self.assertEqual(out, expected + b'\0\0\0')
+        out = bytearray(len(expected))
+        blake2b_chunks(data=data, chunk_size=1024, out=out, digest_size=20)
+        self.assertEqual(out, expected)
+
+    def test_errors(self):
+        for chunks in (blake2b_chunks, blake2s_chunks):
+            self.assertRaises(TypeError, chunks, b'abc')
+            self.assertRaises(TypeError, chunks, u'abc', 1)
+            self.assertRaises(ValueError, chunks, b'abc', 0)
+            self.assertRaises(ValueError, chunks, b'abc', -1)
+            self.assertRaises(ValueError, chunks, b'abc', 1, digest_size=0)
+            self.assertRaises(ValueError, chunks, b'abc', 1, bytearray(10),
+                              digest_size=4)
+            self.assertRaises(BufferError, chunks, b'abc', 1, b'x' * 100)
+
+
+def manual_tree(hash, data, leaf_size, fanout, depth, inner_size,
+                digest_size, **kw):
+    """Builds a tree hash with hash objects, level by level."""
+    def node(data, offset, node_depth, last, size):
+        return hash(data, digest_size=size, fanout=fanout, depth=depth,
+                    leaf_size=leaf_size, inner_size=inner_size,
+                    node_offset=offset, node_depth=node_depth,
+                    last_node=last, **kw).digest()
+
+    size = leaf_size
+    for level in range(depth):
+        chunks = [data[i:i + size] for i in range(0, len(data), size)] or [b'']
+        out = digest_size if level == depth - 1 else inner_size
+        data = b''.join(node(c, i, level, i == len(chunks) - 1, out)
+                        for i, c in enumerate(chunks))
+        size = fanout * inner_size if fanout else len(data)
+    return data
+
+class BLAKE2TreeTest(unittest.TestCase):
+
+    def test_example(self):
+        # Example from the documentation.
+        self.assertEqual(binascii.hexlify(blake2b_tree(
+            bytearray(6000), 4096, fanout=2, inner_size=64, digest_size=32)),
+            b'3ad2a9b37c6070e374c7a8c508fe20ca86b6ed54e286e93a0318e95e881db5aa')
+
+    def test_manual(self):
+        data = bytes(bytearray(range(256))) * 97
+        for tree, hash, max_size in ((blake2b_tree, blake2b, 64),
+                                     (blake2s_tree, blake2s, 32)):
+            for leaf_size, fanout, depth in ((1024, 2, 6), (100, 4, 5),
+                                             (512, 0, 2), (4096, 3, 3),
+                                             (len(data), 2, 1),
+                                             (len(data) + 1, 1, 1),
+                                             (1000, 255, 3)):
+                for threads in (1, 3):
+                    expected = manual_tree(hash, data, leaf_size, fanout,
+                                           depth, max_size, max_size)
+                    self.assertEqual(tree(data, leaf_size, fanout=fanout,
+                                          depth=depth, threads=threads),
+                                     expected)
+            kw = dict(key=b'secret', salt=b'salt', person=b'me')
+            self.assertEqual(tree(data, 300, fanout=4, inner_size=20,
+                                  digest_size=16, **kw),
+                             manual_tree(hash, data, 300, 4, 5, 20, 16, **kw))
+            self.assertEqual(tree(b'', 64),
+                             manual_tree(hash, b'', 64, 2, 1, max_size,
+                                         max_size))
+
+    def test_errors(self):
+        for tree in (blake2b_tree, blake2s_tree):
+            self.assertRaises(TypeError, tree, b'abc')
+            self.assertRaises(TypeError, tree, b'abc', 1, node_offset=1)
+            self.assertRaises(TypeError, tree, b'abc', 1, last_node=True)
+            self.assertRaises(ValueError, tree, b'abc', 0)
+            self.assertRaises(ValueError, tree, b'abc', 2**32)
+            self.assertRaises(ValueError, tree, b'abc', 1, fanout=256)
+            self.assertRaises(ValueError, tree, b'abc', 1, fanout=1)
+            self.assertRaises(ValueError, tree, b'abc', 1, depth=2)
+            self.assertRaises(ValueError, tree, b'abc', 1, inner_size=0)
+            self.assertRaises(ValueError, tree, b'abc', 1, threads=-1)
+            self.assertRaises(ValueError, tree, b'abc', 1, digest_size=0)
+
+
+class BLAKE2DigestIntoTest(unittest.TestCase):
+
+    hashes = (blake2b, blake2s, blake2bp, blake2sp)
+
+    def test_digest_into(self):
+        for hash in self.hashes:
+            h = hash(b'abc', digest_size=20)
+            digest = h.digest()
+            out = bytearray(30)
+            self.assertEqual(h.digest_into(out), 20)
+            self.assertEqual(bytes(out[:20]), digest)
+            self.assertEqual(h.digest_into(memoryview(out), offset=10), 20)
+            self.assertEqual(bytes(out[10:]), digest)
+            h.update(b'def')
+            self.assertEqual(h.digest(), hash(b'abcdef', digest_size=20).digest())
+
+    def test_finalize(self):
+        for hash in self.hashes:
+            digest = hash(b'abc').digest()
+            h = hash(b'abc')
+            c = h.copy()
+            self.assertEqual(h.finalize(), digest)
+            self.assertEqual(c.finalize(), digest)
+            out = bytearray(h.digest_size)
+            h = hash(b'abc')
+            self.assertEqual(h.digest_into(out, finalize=True), h.digest_size)
+            self.assertEqual(bytes(out), digest)
+            for f in (h.digest, h.hexdigest, h.finalize, h.copy().finalize,
+                      lambda: h.update(b'x'), lambda: h.update(b'x' * 5000),
+                      lambda: h.digest_into(out)):
+                self.assertRaises(ValueError, f)
+
+    def test_errors(self):
+        for hash in self.hashes:
+            h = hash(b'abc')
+            self.assertRaises(TypeError, h.digest_into)
+            self.assertRaises(TypeError, h.digest_into, 1)
+            self.assertRaises(BufferError, h.digest_into, b'x' * 64)
+            self.assertRaises(ValueError, h.digest_into, bytearray(h.digest_size - 1))
+            self.assertRaises(ValueError, h.digest_into, bytearray(h.digest_size), 1)
+            self.assertRaises(ValueError, h.digest_into, bytearray(64), -1)
+            self.assertEqual(h.digest(), hash(b'abc').digest())
+
+
+class BLAKE2ResetTest(unittest.TestCase):
+
+    def test_reset(self):
+        params = [{}, {'key': b'k' * 32, 'digest_size': 20, 'salt': b's',
+                       'person': b'p'}]
+        tree = {'fanout': 2, 'depth': 2, 'node_offset': 3, 'node_depth': 1,
+                'inner_size': 16, 'last_node': True}
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            for kw in params + ([tree] if hash in (blake2b, blake2s) else []):
+                h = hash(b'x' * 1000, **kw)
+                c = h.copy()
+                h.reset()
+                self.assertEqual(h.digest(), hash(**kw).digest())
+                h.update(b'abc')
+                self.assertEqual(h.digest(), hash(b'abc', **kw).digest())
+                h.finalize()
+                h.reset()
+                self.assertEqual(h.finalize(), hash(**kw).digest())
+                c.reset()
+                self.assertEqual(c.digest(), hash(**kw).digest())
+
+    def test_prepared(self):
+        tmpl = blake2b_prepare(key=b'key', digest_size=32)
+        h = tmpl.new(b'abc')
+        h.reset()
+        h.update(b'def')
+        self.assertEqual(h.digest(), tmpl.mac(b'def'))
+
+
+class BLAKE2FreeListTest(unittest.TestCase):
+
+    def test_reuse(self):
+        # Freed objects are reused; nothing of their old state may remain.
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            empty = hash().digest()
+            for i in range(3):
+                objs = [hash(b'x' * i, key=b'key', digest_size=16)
+                        for i in range(200)]
+                for h in objs:
+                    h.finalize()
+                del objs, h
+                self.assertEqual([hash().digest() for i in range(200)],
+                                 [empty] * 200)
+
+    def test_templates(self):
+        # Prepared templates are freed to the list of their hash type.
+        empty = blake2b().digest()
+        tmpls = [blake2b_prepare(key=b'key') for i in range(100)]
+        del tmpls
+        self.assertEqual([blake2b().digest() for i in range(100)],
+                         [empty] * 100)
+
+
+class BLAKE2FastCallTest(unittest.TestCase):
+
+    def test_constructor(self):
+        data = b'abc' * 1000
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            # salt=b'' leaves parameters unchanged but takes the full parser
+            self.assertEqual(hash().digest(), hash(salt=b'').digest())
+            expected = hash(data, 20, salt=b'').digest()
+            self.assertEqual(hash(data, 20).digest(), expected)
+            self.assertEqual(hash(data, digest_size=20).digest(), expected)
+            self.assertEqual(hash(digest_size=20, data=data).digest(),
+                             expected)
+            self.assertEqual(hash(data=data).digest(),
+                             hash(data, salt=b'').digest())
+            self.assertEqual(hash(digest_size=True).digest_size, 1)
+
+    def test_errors(self):
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            self.assertRaises(TypeError, hash, b'a', data=b'b')
+            self.assertRaises(TypeError, hash, b'a', 20, digest_size=20)
+            self.assertRaises(TypeError, hash, b'a', 20, b'key', b'salt',
+                              b'person', 1, 1, 0, 0, 0, 0, False, 0)
+            self.assertRaises(TypeError, hash, datum=b'a')
+            self.assertRaises(TypeError, hash, u'abc')
+            self.assertRaises(TypeError, hash, digest_size=20.0)
+            self.assertRaises(ValueError, hash, digest_size=0)
+            self.assertRaises(OverflowError, hash, digest_size=1 << 40)
+
+    def test_update(self):
+        h = blake2b()
+        self.assertRaises(TypeError, h.update)
+        self.assertRaises(TypeError, h.update, b'a', b'b')
+        self.assertRaises(TypeError, h.update, data=b'a')
+
+    def test_template(self):
+        tmpl = blake2s_prepare(key=b'key')
+        self.assertEqual(tmpl.mac(b'abc'), tmpl.mac(data=b'abc'))
+        self.assertEqual(tmpl.new(b'abc').digest(), tmpl.mac(b'abc'))
+        self.assertEqual(tmpl.new(data=b'abc').digest(), tmpl.mac(b'abc'))
+        self.assertEqual(tmpl.new().digest(), tmpl.mac(b''))
+        self.assertRaises(TypeError, tmpl.mac)
+        self.assertRaises(TypeError, tmpl.mac, b'a', b'b')
+        self.assertRaises(TypeError, tmpl.mac, b'a', data=b'b')
+        self.assertRaises(TypeError, tmpl.new, b'a', b'b')
+
+
+class BLAKE2DigestFunctionTest(unittest.TestCase):
+
+    def test_digest(self):
+        params = [{}, {'digest_size': 20}, {'key': b'k' * 32, 'salt': b's',
+                                            'person': b'p'},
+                  {'fanout': 2, 'depth': 2, 'node_offset': 3,
+                   'node_depth': 1, 'inner_size': 16, 'last_node': True}]
+        for hash, func in ((blake2b, blake2b_digest),
+                           (blake2s, blake2s_digest)):
+            for data in (b'', b'abc', b'x' * 5000):
+                for kw in params:
+                    self.assertEqual(func(data, **kw),
+                                     hash(data, **kw).digest())
+            self.assertEqual(func(), hash().digest())
+            self.assertEqual(func(b'abc', 16), hash(b'abc', 16).digest())
+            self.assertEqual(func(data=b'abc'), hash(b'abc').digest())
+
+    def test_errors(self):
+        for func in (blake2b_digest, blake2s_digest):
+            self.assertRaises(TypeError, func, u'abc')
+            self.assertRaises(TypeError, func, b'abc', foo=1)
+            self.assertRaises(ValueError, func, b'abc', digest_size=0)
+            self.assertRaises(ValueError, func, b'abc', key=b'k' * 65)
+
+
+class BLAKE2HexDigestTest(unittest.TestCase):
+
+    def test_hexdigest(self):
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            for size in range(1, hash().digest_size + 1):
+                h = hash(b'\x00\xff' * 100, digest_size=size)
+                expected = binascii.hexlify(h.digest())
+                self.assertEqual(h.hexdigest_bytes(), expected)
+                self.assertEqual(h.hexdigest(), expected.decode('ascii'))
+                self.assertTrue(isinstance(h.hexdigest_bytes(), bytes))
+
+    def test_finalized(self):
+        h = blake2b(b'abc')
+        h.finalize()
+        self.assertRaises(ValueError, h.hexdigest)
+        self.assertRaises(ValueError, h.hexdigest_bytes)
+
+
+class BLAKE2FileTest(unittest.TestCase):
+
+    def setUp(self):
+        fd, self.path = tempfile.mkstemp()
+        os.close(fd)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def write(self, data):
+        with open(self.path, 'wb') as f:
+            f.write(data)
+
+    def test_file(self):
+        for size in (0, 1, 1000, (1 << 20) + 123):
+            data = bytes(bytearray(i % 251 for i in range(size)))
+            self.write(data)
+            for hash, func in ((blake2b, blake2b_file),
+                               (blake2s, blake2s_file)):
+                self.assertEqual(func(self.path), hash(data).digest())
+                self.assertEqual(func(file=self.path, digest_size=20,
+                                      key=b'key'),
+                                 hash(data, digest_size=20,
+                                      key=b'key').digest())
+
+    def test_queue_depth(self):
+        for size in (0, 1000, 1 << 20, (3 << 20) + 123):
+            data = bytes(bytearray(i % 251 for i in range(size)))
+            self.write(data)
+            for depth in (1, 2, 8):
+                self.assertEqual(blake2b_file(self.path, queue_depth=depth),
+                                 blake2b(data).digest())
+                self.assertEqual(blake2s_file(self.path, queue_depth=depth,
+                                              key=b'key'),
+                                 blake2s(data, key=b'key').digest())
+        self.assertRaises(ValueError, blake2b_file, self.path,
+                          queue_depth=-1)
+        self.assertRaises(ValueError, blake2b_file, self.path,
+                          queue_depth=100000)
+
+    def test_mmap(self):
+        for size in (0, 1000, (5 << 20) + 123):
+            data = bytes(bytearray(i % 251 for i in range(size)))
+            self.write(data)
+            self.assertEqual(blake2b_file(self.path, mmap=True),
+                             blake2b(data).digest())
+            self.assertEqual(blake2s_file(self.path, mmap=True, key=b'key'),
+                             blake2s(data, key=b'key').digest())
+            self.assertEqual(hash_files([self.path], mmap=True),
+                             [blake2b(data).digest()])
+
+    def test_fd(self):
+        self.write(b'abcdef')
+        fd = os.open(self.path, os.O_RDONLY)
+        try:
+            os.lseek(fd, 3, os.SEEK_SET)
+            self.assertEqual(blake2b_file(fd), blake2b(b'abcdef').digest())
+            if hasattr(os, 'pread'):
+                self.assertEqual(os.lseek(fd, 0, os.SEEK_CUR), 3)
+        finally:
+            os.close(fd)
+
+    def test_pipe(self):
+        r, w = os.pipe()
+        try:
+            os.write(w, b'abc' * 100)
+            os.close(w)
+            w = None
+            self.assertEqual(blake2s_file(r), blake2s(b'abc' * 100).digest())
+        finally:
+            os.close(r)
+            if w is not None:
+                os.close(w)
+
+    def test_errors(self):
+        self.assertRaises(EnvironmentError, blake2b_file,
+                          self.path + '.missing')
+        self.assertRaises(TypeError, blake2b_file, 1.5)
+        self.assertRaises(TypeError, blake2b_file, self.path, data=b'')
+        self.assertRaises(ValueError, blake2b_file, self.path,
+                          digest_size=100)
+        self.assertRaises(ValueError, blake2b_file, -1)
+
+
+class BLAKE2HashFilesTest(unittest.TestCase):
+
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.paths = []
+        for i in range(20):
+            path = os.path.join(self.dir, 'f%d' % i)
+            with open(path, 'wb') as f:
+                f.write(b'x' * (i * 1000))
+            self.paths.append(path)
+
+    def tearDown(self):
+        for path in self.paths:
+            os.remove(path)
+        os.rmdir(self.dir)
+
+    def test_hash_files(self):
+        for threads in (0, 1, 4):
+            self.assertEqual(hash_files(self.paths, threads=threads),
+                             [blake2b_file(p) for p in self.paths])
+        self.assertEqual(hash_files(iter(self.paths), 'blake2s',
+                                    digest_size=16, key=b'key'),
+                         [blake2s_file(p, digest_size=16, key=b'key')
+                          for p in self.paths])
+        self.assertEqual(hash_files(self.paths, 'blake2s', queue_depth=4),
+                         [blake2s_file(p) for p in self.paths])
+        self.assertEqual(hash_files([]), [])
+
+    def test_errors(self):
+        missing = os.path.join(self.dir, 'missing')
+        try:
+            hash_files(self.paths + [missing])
+        except EnvironmentError as e:
+            self.assertEqual(e.filename, missing)
+        else:
+            self.fail('no error for missing file')
+        self.assertRaises(ValueError, hash_files, self.paths, 'md5')
+        self.assertRaises(ValueError, hash_files, self.paths, threads=-1)
+        self.assertRaises(ValueError, hash_files, self.paths,
+                          queue_depth=-1)
+        self.assertRaises(ValueError, hash_files, self.paths,
+                          digest_size=100)
+        self.assertRaises(TypeError, hash_files, [1])
+        self.assertRaises(TypeError, hash_files, 1)
+
+
+class BLAKE2UpdateFromFdTest(unittest.TestCase):
+
+    def setUp(self):
+        self.data = bytes(bytearray(i % 251 for i in range(300000)))
+        fd, self.path = tempfile.mkstemp()
+        os.write(fd, self.data)
+        os.close(fd)
+        self.fd = os.open(self.path, os.O_RDONLY)
+
+    def tearDown(self):
+        os.close(self.fd)
+        os.remove(self.path)
+
+    def test_update_from_fd(self):
+        for hash in (blake2b, blake2s, blake2bp, blake2sp):
+            for bufsize in (1000, 4096, 1 << 20):
+                os.lseek(self.fd, 0, os.SEEK_SET)
+                h = hash(b'abc', key=b'key')
+                self.assertEqual(h.update_from_fd(self.fd, bufsize=bufsize),
+                                 len(self.data))
+                self.assertEqual(h.digest(),
+                                 hash(b'abc' + self.data, key=b'key').digest())
+
+    def test_length(self):
+        os.lseek(self.fd, 10, os.SEEK_SET)
+        h = blake2b()
+        self.assertEqual(h.update_from_fd(self.fd, 100000, bufsize=3000),
+                         100000)
+        self.assertEqual(os.lseek(self.fd, 0, os.SEEK_CUR), 100010)
+        self.assertEqual(h.update_from_fd(self.fd, 0), 0)
+        self.assertEqual(h.update_from_fd(self.fd, length=None), 199990)
+        self.assertEqual(h.update_from_fd(self.fd), 0)
+        self.assertEqual(h.digest(), blake2b(self.data[10:]).digest())
+
+    def test_pipe(self):
+        r, w = os.pipe()
+        try:
+            os.write(w, b'abc' * 1000)
+            os.close(w)
+            w = None
+            h = blake2s()
+            self.assertEqual(h.update_from_fd(r, bufsize=100), 3000)
+            self.assertEqual(h.digest(), blake2s(b'abc' * 1000).digest())
+        finally:
+            os.close(r)
+            if w is not None:
+                os.close(w)
+
+    def test_errors(self):
+        h = blake2b()
+        self.assertRaises(ValueError, h.update_from_fd, -1)
+        self.assertRaises(ValueError, h.update_from_fd, self.fd, -1)
+        self.assertRaises(ValueError, h.update_from_fd, self.fd, bufsize=0)
+        self.assertRaises(TypeError, h.update_from_fd, self.path)
+        h.finalize()
+        self.assertRaises(ValueError, h.update_from_fd, self.fd)
+
+    def test_read_error(self):
+        fd = os.open(self.path, os.O_WRONLY)
+        try:
+            h = blake2b(b'abc')
+            try:
+                h.update_from_fd(fd)
+            except EnvironmentError as e:
+                self.assertEqual(e.nread, 0)
+            else:
+                self.fail('reading a write-only descriptor succeeded')
+            self.assertEqual(h.digest(), blake2b(b'abc').digest())
+        finally:
+            os.close(fd)
+
+
+class BLAKE2StateTest(unittest.TestCase):
+
+    hashes = ((blake2b, blake2b_from_state), (blake2s, blake2s_from_state),
+              (blake2bp, blake2bp_from_state),
+              (blake2sp, blake2sp_from_state))
+    data = bytes(bytearray(i % 251 for i in range(3000)))
+
+    def test_resume(self):
+        for hash, from_state in self.hashes:
+            for kw in ({}, {'digest_size': 20, 'key': b'key'},
+                       {'salt': b'salt', 'person': b'me'}):
+                expected = hash(self.data, **kw).digest()
+                for n in (0, 1, 64, 65, 128, 129, 1000):
+                    h = from_state(hash(self.data[:n], **kw).state_bytes(
+                        include_key=True))
+                    h.update(self.data[n:])
+                    self.assertEqual(h.digest(), expected)
+                h.reset()
+                self.assertEqual(h.digest(), hash(**kw).digest())
+
+    def test_without_key(self):
+        key = b'k' * 16
+        for hash, from_state in self.hashes:
+            self.assertRaises(ValueError, hash(key=key).state_bytes)
+            # Leaves of blake2bp and blake2sp keep the key block until they
+            # get data, which is buffered up to a block for each leaf first.
+            sizes = (1000,) if hash in (blake2bp, blake2sp) else (5, 1000)
+            for n in sizes:
+                state = hash(self.data[:n], key=key).state_bytes()
+                self.assertFalse(b'k' * 11 in state)
+                h = from_state(state)
+                self.assertRaises(ValueError, h.state_bytes, include_key=True)
+                h.update(self.data[n:])
+                self.assertEqual(h.digest(),
+                                 hash(self.data, key=key).digest())
+                self.assertRaises(ValueError, h.reset)
+
+    def test_tree_params(self):
+        h = blake2b(b'abc', fanout=2, depth=3, leaf_size=4096,
+                    node_offset=5, node_depth=1, inner_size=32,
+                    last_node=True)
+        self.assertEqual(blake2b_from_state(h.state_bytes()).digest(),
+                         h.digest())
+
+    def test_pickle(self):
+        import pickle
+        for hash, from_state in self.hashes:
+            h = hash(self.data[:1000], key=b'key')
+            for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+                h2 = pickle.loads(pickle.dumps(h, proto))
+                h2.update(self.data[1000:])
+                self.assertEqual(h2.digest(),
+                                 hash(self.data, key=b'key').digest())
+                self.assertRaises(ValueError, h2.reset)
+            self.assertRaises(ValueError, pickle.dumps, hash(key=b'key'))
+
+    def test_format(self):
+        # Words are stored in little-endian order on any machine.
+        state = blake2s().state_bytes()
+        self.assertEqual(state[:9], b'\x01\x07blake2s')
+        self.assertEqual(state[9:11], b'\x20\x00')
+        self.assertEqual(state[41:45], b'\x47\xe6\x08\x6b')
+        self.assertEqual(len(state), 9 + 32 + 114 + 1)
+        self.assertEqual(len(blake2b(b'a', key=b'key').state_bytes()),
+                         9 + 64 + 226 + 1)
+        self.assertEqual(blake2b(key=b'key').state_bytes(True)[-4:],
+                         b'\x03key')
+
+    def test_errors(self):
+        state = blake2b().state_bytes()
+        for bad in (b'', b'\x02' + state[1:], blake2s().state_bytes(),
+                    state[:-1], state + b'\x00'):
+            self.assertRaises(ValueError, blake2b_from_state, bad)
+        self.assertRaises(TypeError, blake2b_from_state, 1)
+        h = blake2b()
+        h.finalize()
+        self.assertRaises(ValueError, h.state_bytes)
+
+    def test_corrupted(self):
+        # Finalized states and nonzero bytes past the buffered data, which
+        # are never stored, are rejected. After the header and parameter
+        # block, (first leaf) states have f at offset 40 and the buffer at
+        # 50; the last byte before the key length ends the buffer (shared
+        # by leaves for blake2sp).
+        for from_state, h in ((blake2s_from_state, blake2s(b'abc')),
+                              (blake2sp_from_state, blake2sp(b'abc'))):
+            state = bytearray(h.state_bytes())
+            base = 2 + len(h.name) + 32
+            for offset in (base + 40, base + 44, base + 53, len(state) - 2):
+                bad = bytearray(state)
+                bad[offset] ^= 1
+                self.assertRaises(ValueError, from_state, bytes(bad))
+
+
+class BLAKE2LogTest(unittest.TestCase):
+
+    data = bytes(bytearray(i % 251 for i in range(100000)))
+
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.path = os.path.join(self.dir, 'log')
+        self.index = os.path.join(self.dir, 'log.index')
+
+    def tearDown(self):
+        for name in os.listdir(self.dir):
+            os.remove(os.path.join(self.dir, name))
+        os.rmdir(self.dir)
+
+    def write(self, data, mode='wb'):
+        with open(self.path, mode) as f:
+            f.write(data)
+
+    def test_append(self):
+        for hash, log in ((blake2b, blake2b_log), (blake2s, blake2s_log)):
+            self.write(b'')
+            for end in (0, 1, 4096, 25000, 25001, 100000):
+                self.write(self.data[os.path.getsize(self.path):end], 'ab')
+                self.assertEqual(log(self.path, self.index, interval=4096,
+                                     key=b'key'),
+                                 (hash(self.data[:end], key=b'key').digest(),
+                                  end))
+            # The index is replaced without leaving temporary files.
+            self.assertEqual(sorted(os.listdir(self.dir)),
+                             ['log', 'log.index'])
+            os.remove(self.index)
+
+    def test_resume(self):
+        self.write(self.data[:50000])
+        blake2b_log(self.path, self.index, interval=4096)
+        # Data before the last checkpoint isn't read again.
+        self.write(b'x' + self.data[1:], 'r+b')
+        self.assertEqual(blake2b_log(self.path, self.index, interval=4096),
+                         (blake2b(self.data).digest(), len(self.data)))
+
+    def test_rebuild(self):
+        self.write(self.data)
+        blake2b_log(self.path, self.index, interval=4096)
+        # Checkpoints made with other parameters, key or interval are
+        # discarded.
+        self.assertEqual(blake2b_log(self.path, self.index, key=b'key'),
+                         (blake2b(self.data, key=b'key').digest(),
+                          len(self.data)))
+        self.assertEqual(blake2b_log(self.path, self.index, digest_size=20),
+                         (blake2b(self.data, digest_size=20).digest(),
+                          len(self.data)))
+        self.assertEqual(blake2b_log(self.path, self.index, interval=1000),
+                         (blake2b(self.data).digest(), len(self.data)))
+
+    def test_truncated(self):
+        self.write(self.data)
+        blake2b_log(self.path, self.index, interval=4096)
+        with open(self.index, 'ab') as f:
+            f.write(b'partial record')
+        self.write(self.data[:9000])
+        self.assertEqual(blake2b_log(self.path, self.index, interval=4096),
+                         (blake2b(self.data[:9000]).digest(), 9000))
+
+    def test_index_secrecy(self):
+        key = b'0123456789 secret key'
+        self.write(self.data[:10000])
+        for log in (blake2b_log, blake2s_log):
+            log(self.path, self.index, interval=4096, key=key)
+            with open(self.index, 'rb') as f:
+                self.assertFalse(key in f.read())
+            if os.name == 'posix':
+                self.assertEqual(os.stat(self.index).st_mode & 0o777, 0o600)
+            os.remove(self.index)
+
+    def test_errors(self):
+        self.write(b'abc')
+        self.assertRaises(ValueError, blake2b_log, self.path, self.index,
+                          interval=0)
+        self.assertRaises(EnvironmentError, blake2b_log, self.path + 'x',
+                          self.index)
+        try:
+            blake2b_log(self.path, os.path.join(self.dir, 'x', 'index'))
+        except EnvironmentError as e:
+            self.assertEqual(e.filename, os.path.join(self.dir, 'x', 'index'))
+        else:
+            self.fail('no error for missing index directory')
+
+
+class BLAKE2PrepareTest(unittest.TestCase):
+
+    def test_prepare(self):
+        params = [{}, {'key': b'k' * 32, 'digest_size': 20},
+                  {'key': b'key', 'salt': b's', 'person': b'p', 'fanout': 2,
+                   'depth': 2, 'node_offset': 3, 'inner_size': 16,
+                   'last_node': True}]
+        data = [b'', b'abc', b'x' * 64, b'y' * 129, b'z' * 5000]
+        for prepare, hash in ((blake2b_prepare, blake2b),
+                              (blake2s_prepare, blake2s)):
+            for kw in params:
+                tmpl = prepare(**kw)
+                self.assertEqual(tmpl.name, hash().name)
+                self.assertEqual(tmpl.block_size, hash().block_size)
+                self.assertEqual(tmpl.digest_size, hash(**kw).digest_size)
+                self.assertEqual(tmpl.new().digest(), hash(**kw).digest())
+                for d in data:
+                    digest = hash(d, **kw).digest()
+                    self.assertEqual(tmpl.mac(d), digest)
+                    self.assertEqual(tmpl.new(d).digest(), digest)
+                    h = tmpl.new(data=d[:10])
+                    h.update(d[10:])
+                    self.assertEqual(h.digest(), digest)
+
+    def test_key_absorbed(self):
+        # Non-empty messages start with the key block already compressed,
+        # in the state a hash object reaches once data follows the key.
+        for prepare, hash in ((blake2b_prepare, blake2b),
+                              (blake2s_prepare, blake2s)):
+            tmpl = prepare(key=b'key')
+            for d in (b'a', b'x' * 1000):
+                h = hash(key=b'key')
+                h.update(d)
+                self.assertEqual(tmpl.new(d).state_bytes(), h.state_bytes())
+            self.assertEqual(tmpl.new().state_bytes(True),
+                             hash(key=b'key').state_bytes(True))
+
+    def test_errors(self):
+        for prepare in (blake2b_prepare, blake2s_prepare):
+            self.assertRaises(TypeError, prepare, b'a')
+            self.assertRaises(TypeError, prepare, data=b'a')
+            self.assertRaises(ValueError, prepare, digest_size=0)
+            self.assertRaises(ValueError, prepare, key=b'x' * 65)
+            self.assertRaises(TypeError, prepare().mac)
+            self.assertRaises(TypeError, prepare().mac, u'a')
+            self.assertRaises(TypeError, prepare().new, 1)
+
+
 def testsuite():
     suite = unittest.TestSuite()
-    cases = [BLAKE2bTest, BLAKE2bKeyedTest, BLAKE2sTest, BLAKE2sKeyedTest]
+    cases = [BLAKE2bTest, BLAKE2bKeyedTest, BLAKE2sTest, BLAKE2sKeyedTest,
+             BLAKE2bpTest, BLAKE2bpKeyedTest, BLAKE2spTest, BLAKE2spKeyedTest,
+             BLAKE2ManyTest, BLAKE2ChunksTest, BLAKE2TreeTest,
+             BLAKE2PrepareTest, BLAKE2DigestIntoTest, BLAKE2ResetTest,
+             BLAKE2FreeListTest, BLAKE2FastCallTest,
+             BLAKE2DigestFunctionTest, BLAKE2HexDigestTest, BLAKE2FileTest,
+             BLAKE2HashFilesTest, BLAKE2UpdateFromFdTest, BLAKE2StateTest,
+             BLAKE2LogTest]
     for c in cases:
         suite.addTests(unittest.makeSuite(c))
     return suite